@@ -17,7 +17,8 @@ Options g_Options = {
     .dropdashEnabled = true,
     .instaShieldEnabled = false,
     .peeloutEnabled = true,
-    .cameraType = CAMERA_GENESIS
+    .cameraType = CAMERA_GENESIS,
+    .threadedSimulation = false
 };
 
 
@@ -90,6 +91,7 @@ void ResetOptions(Options *options) {
     options->instaShieldEnabled = false;
     options->peeloutEnabled = true;
     options->cameraType = CAMERA_GENESIS;
+    options->threadedSimulation = false;
 }
 
 bool LoadOptions(const char *filePath) {
@@ -111,6 +113,10 @@ bool LoadOptions(const char *filePath) {
     int cameraTypeInt;
     fscanf(file, "cameraType=%d\n", &cameraTypeInt);
     g_Options.cameraType = (CameraType)cameraTypeInt;
+    int threadedInt = 0;
+    if (fscanf(file, "threadedSimulation=%d\n", &threadedInt) == 1) {
+        g_Options.threadedSimulation = threadedInt != 0;
+    }
     fclose(file);
 
     return true;
@@ -133,6 +139,7 @@ bool SaveOptions(const char *filePath) {
     fprintf(file, "instaShieldEnabled=%d\n", g_Options.instaShieldEnabled);
     fprintf(file, "peeloutEnabled=%d\n", g_Options.peeloutEnabled);
     fprintf(file, "cameraType=%d\n", (int)g_Options.cameraType);
+    fprintf(file, "threadedSimulation=%d\n", g_Options.threadedSimulation);
     fclose(file);
 
     return true;
@@ -114,6 +114,7 @@ typedef struct {
     bool instaShieldEnabled; // Instant shield recharge
     bool peeloutEnabled;     // Peelout ability
     CameraType cameraType;   // Selected camera type
+    bool threadedSimulation; // Run gameplay on its own thread
 } Options;
 
 extern SaveData g_SaveData;
@@ -6,4 +6,5 @@
 #include "data-csv_loader.h"
 #include "collision_data/collision-generated_heightmaps.h"
 #include "collision_data/collision-generated_widthmaps.h"
-#include "collision_data/collision-generated_tile_angles.h"
\ No newline at end of file
+#include "collision_data/collision-generated_tile_angles.h"
+#include "data-tile_flags.h"
\ No newline at end of file
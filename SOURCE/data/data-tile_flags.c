@@ -0,0 +1,104 @@
+// Tile flags - per-tile solidity bits read from tileset properties
+#include "data-tile_flags.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "raylib.h"
+
+void InitTileFlags(TileFlagTable* table) {
+    if (!table) return;
+    memset(table->flags, TILE_FLAGS_ALL_SOLID, sizeof(table->flags));
+    table->flags[0] = 0;
+}
+
+// Solidity value to path A bits (shift left by 2 for path B); -1 if unknown
+static int ParseSolidity(const char* value, size_t length) {
+    if (length == 3 && strncmp(value, "all", 3) == 0) return TILE_FLAG_TOP_A | TILE_FLAG_LRB_A;
+    if (length == 3 && strncmp(value, "top", 3) == 0) return TILE_FLAG_TOP_A;
+    if (length == 3 && strncmp(value, "lrb", 3) == 0) return TILE_FLAG_LRB_A;
+    if (length == 4 && strncmp(value, "none", 4) == 0) return 0;
+    return -1;
+}
+
+// Find attr="..." inside [start, end); returns the value start and writes its length
+static const char* FindAttribute(const char* start, const char* end, const char* attr, size_t* outLength) {
+    size_t attrLength = strlen(attr);
+    for (const char* p = start; p + attrLength + 2 < end; p++) {
+        if (strncmp(p, attr, attrLength) != 0 || p[attrLength] != '=' || p[attrLength + 1] != '"') continue;
+        if (p > start && p[-1] != ' ' && p[-1] != '\t' && p[-1] != '\n') continue;
+
+        const char* value = p + attrLength + 2;
+        const char* close = memchr(value, '"', (size_t)(end - value));
+        if (!close) return NULL;
+        *outLength = (size_t)(close - value);
+        return value;
+    }
+    return NULL;
+}
+
+// Apply every solidity property inside one <tile> element
+static void ApplyTileProperties(uint8_t* flags, const char* start, const char* end, const char* tsxPath, int tileId) {
+    const char* p = start;
+    while ((p = strstr(p, "<property ")) && p < end) {
+        const char* tagEnd = strchr(p, '>');
+        if (!tagEnd || tagEnd > end) break;
+
+        size_t nameLength, valueLength;
+        const char* name = FindAttribute(p, tagEnd, "name", &nameLength);
+        const char* value = FindAttribute(p, tagEnd, "value", &valueLength);
+        p = tagEnd;
+        if (!name || !value) continue;
+
+        uint8_t mask;
+        if (nameLength == 8 && strncmp(name, "solidity", 8) == 0) mask = TILE_FLAGS_ALL_SOLID;
+        else if (nameLength == 9 && strncmp(name, "solidityA", 9) == 0) mask = TILE_FLAGS_PATH_A;
+        else if (nameLength == 9 && strncmp(name, "solidityB", 9) == 0) mask = TILE_FLAGS_PATH_B;
+        else continue;
+
+        int bits = ParseSolidity(value, valueLength);
+        if (bits < 0) {
+            printf("Unknown solidity '%.*s' for tile %d in %s\n", (int)valueLength, value, tileId, tsxPath);
+            continue;
+        }
+        uint8_t both = (uint8_t)(bits | (bits << 2));
+        *flags = (uint8_t)((*flags & ~mask) | (both & mask));
+    }
+}
+
+bool LoadTileFlags(TileFlagTable* table, const char* tsxPath, int firstGid) {
+    if (!table || !tsxPath) return false;
+
+    char* text = LoadFileText(tsxPath);
+    if (!text) {
+        printf("Error loading tileset properties from %s\n", tsxPath);
+        return false;
+    }
+
+    int applied = 0;
+    const char* p = text;
+    while ((p = strstr(p, "<tile "))) {
+        const char* tagEnd = strchr(p, '>');
+        if (!tagEnd) break;
+
+        size_t idLength;
+        const char* idText = FindAttribute(p, tagEnd, "id", &idLength);
+        int tileId = idText ? atoi(idText) + firstGid : -1;
+
+        // Self-closing tiles carry no properties
+        const char* body = tagEnd + 1;
+        const char* bodyEnd = (tagEnd[-1] == '/') ? body : strstr(body, "</tile>");
+        if (!bodyEnd) break;
+
+        if (tileId > 0 && tileId < TILESET_TILE_COUNT) {
+            ApplyTileProperties(&table->flags[tileId], body, bodyEnd, tsxPath, tileId);
+            applied++;
+        } else if (idText) {
+            printf("Tile %d in %s is outside the collision tileset\n", tileId, tsxPath);
+        }
+        p = bodyEnd;
+    }
+
+    UnloadFileText(text);
+    printf("Loaded tile flags for %d tiles from %s\n", applied, tsxPath);
+    return true;
+}
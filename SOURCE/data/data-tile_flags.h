@@ -0,0 +1,35 @@
+// Tile flags header - per-tile solidity bits read from tileset properties
+#ifndef DATA_TILE_FLAGS_H
+#define DATA_TILE_FLAGS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "collision_data/collision-generated_heightmaps.h"
+
+// Solidity bits, one top and one left/right/bottom bit per collision path
+#define TILE_FLAG_TOP_A   0x01
+#define TILE_FLAG_LRB_A   0x02
+#define TILE_FLAG_TOP_B   0x04
+#define TILE_FLAG_LRB_B   0x08
+
+#define TILE_FLAGS_PATH_A    (TILE_FLAG_TOP_A | TILE_FLAG_LRB_A)
+#define TILE_FLAGS_PATH_B    (TILE_FLAG_TOP_B | TILE_FLAG_LRB_B)
+#define TILE_FLAGS_ALL_SOLID (TILE_FLAGS_PATH_A | TILE_FLAGS_PATH_B)
+
+// Flags indexed by tile ID, the same indexing as the generated heightmaps
+typedef struct {
+    uint8_t flags[TILESET_TILE_COUNT];
+} TileFlagTable;
+
+// Fill the table with the default: tile 0 empty, every other tile solid on both paths
+void InitTileFlags(TileFlagTable* table);
+
+// Override defaults from the custom properties of a Tiled .tsx file.
+// Recognised tile properties (values: all, top, lrb, none):
+//   solidity  - both paths
+//   solidityA - path A only
+//   solidityB - path B only
+// firstGid is the tileset's firstgid in the map, so tile N maps to ID N + firstGid.
+bool LoadTileFlags(TileFlagTable* table, const char* tsxPath, int firstGid);
+
+#endif // DATA_TILE_FLAGS_H
@@ -17,20 +17,114 @@ int seconds = 0;
 int milliseconds = 0;
 const char* timeString = "";
 
+// Retained HUD layer: the HUD is rendered into this texture only when a visible
+// value changes and composited with a single draw every frame. It covers the
+// left strip of the virtual screen (counters at the top, lives at the bottom).
+// The centiseconds change every frame while the timer runs, so they are drawn
+// on top of the layer instead of being part of it.
+#define HUD_LAYER_WIDTH 160
+
+static RenderTexture2D hudLayer;
+static bool hudLayerDirty = true;
+static int drawnScore, drawnRings, drawnLives, drawnSeconds;
+
+static char scoreString[16];
+static char ringsString[16];
+static char timeBuffer[24];
+static char livesString[24];
+static char centisecondsString[4];
+static float centisecondsX; // Right after the retained "M:SS:"
+
+// Writes a non-negative integer with at least `minDigits` digits, returns the length
+static int FormatHUDNumber(char* out, int value, int minDigits) {
+    char digits[12];
+    int count = 0;
+    if (value < 0) value = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0 && count < (int)sizeof(digits));
+    while (count < minDigits) digits[count++] = '0';
+
+    for (int i = 0; i < count; i++) out[i] = digits[count - 1 - i];
+    out[count] = '\0';
+    return count;
+}
+
+// Re-renders the HUD layer if score, rings, lives or the displayed minutes and
+// seconds changed. Must run outside of BeginTextureMode() since raylib can't nest render
+// targets, and on the render thread since it issues GL calls. The values are
+// passed in so a simulation thread can hand over a copy instead of gameHUD.
+void RefreshHUD(const HUDValues* values) {
+    totalMilliseconds = (int)values->time;
+    minutes = totalMilliseconds / 60000;
+    seconds = (totalMilliseconds / 1000) % 60;
+    milliseconds = (totalMilliseconds % 1000) / 10; // Two digits
+    FormatHUDNumber(centisecondsString, milliseconds, 2);
+    int visibleSeconds = minutes * 60 + seconds;
+
+    if (!hudLayerDirty && drawnScore == values->score && drawnRings == values->rings &&
+        drawnLives == values->lives && drawnSeconds == visibleSeconds) {
+        return;
+    }
+    hudLayerDirty = false;
+    drawnScore = values->score;
+    drawnRings = values->rings;
+    drawnLives = values->lives;
+    drawnSeconds = visibleSeconds;
+
+    FormatHUDNumber(scoreString, values->score, 1);
+    FormatHUDNumber(ringsString, values->rings, 1);
+    int length = FormatHUDNumber(timeBuffer, minutes, 1);
+    timeBuffer[length++] = ':';
+    length += FormatHUDNumber(timeBuffer + length, seconds, 2);
+    timeBuffer[length++] = ':';
+    timeBuffer[length] = '\0';
+    timeString = timeBuffer;
+    centisecondsX = (float)(10 + 54 + MeasurePrestoNumbersBWidth(timeBuffer, 1.0f));
+    memcpy(livesString, "SONIC * ", 8);
+    FormatHUDNumber(livesString + 8, values->lives, 1);
+
+    BeginTextureMode(hudLayer);
+    ClearBackground(BLANK);
+
+    // Draw HUD elements in classic Sonic layout
+    // Top left: SCORE, RINGS, TIME
+    DrawTextureEx(scoreText, (Vector2){9, 10}, 0.0f, 1.0f, WHITE);
+    DrawTextureEx(timeText, (Vector2){9, 30}, 0.0f, 1.0f, WHITE);
+    DrawTextureEx(ringsText, (Vector2){9, 50}, 0.0f, 1.0f, WHITE); // swapped time and rings positions
+
+    DrawPrestoNumbersB(scoreString, (Vector2){10 + 54, 10}, 1.0f, WHITE);
+    DrawPrestoNumbersB(ringsString, (Vector2){10 + 54, 50}, 1.0f, WHITE);
+    DrawPrestoNumbersB(timeString, (Vector2){10 + 54, 30}, 1.0f, WHITE);
+    // Bottom: Lives using small Sonic font
+    DrawSmallSonicText(livesString, (Vector2){10, VIRTUAL_SCREEN_HEIGHT - 25}, 1.0f, YELLOW);
+
+    EndTextureMode();
+}
+
 void InitHUD() {
     memset(&gameHUD, 0, sizeof(HUD));
     // Load HUD sprites
-    scoreText = LoadTexture("RESOURCES/sprite/spritesheet/ui/SCORE.png");
-    ringsText = LoadTexture("RESOURCES/sprite/spritesheet/ui/RINGS.png");
-    timeText = LoadTexture("RESOURCES/sprite/spritesheet/ui/TIME.png");
+    scoreText = LoadCachedTexture("RESOURCES/sprite/spritesheet/ui/SCORE.png");
+    ringsText = LoadCachedTexture("RESOURCES/sprite/spritesheet/ui/RINGS.png");
+    timeText = LoadCachedTexture("RESOURCES/sprite/spritesheet/ui/TIME.png");
+
+    hudLayer = LoadRenderTexture(HUD_LAYER_WIDTH, VIRTUAL_SCREEN_HEIGHT);
+    hudLayerDirty = true;
 }
 
-void UpdateHUD(float deltaTime) {
+// Simulation side of the HUD, touches no GPU state
+void AdvanceHUDTimer(float deltaTime) {
     if (gameHUD.isTimerActive) {
         gameHUD.time += (int)(deltaTime * 1000); // Convert to milliseconds
     }
 }
 
+HUDValues GetHUDValues(void) {
+    return (HUDValues){ gameHUD.score, gameHUD.lives, gameHUD.rings, gameHUD.time };
+}
+
 void UpdateValues(int scoreDelta, int livesDelta, int ringsDelta) {
     gameHUD.score += scoreDelta;
     gameHUD.lives += livesDelta;
@@ -38,21 +132,10 @@ void UpdateValues(int scoreDelta, int livesDelta, int ringsDelta) {
 }
 
 void DrawHUD() {
-    // Draw HUD elements in classic Sonic layout
-    // Top left: SCORE, RINGS, TIME
-    DrawTextureEx(scoreText, (Vector2){9, 10}, 0.0f, 1.0f, WHITE);
-    DrawTextureEx(timeText, (Vector2){9, 30}, 0.0f, 1.0f, WHITE);
-    DrawTextureEx(ringsText, (Vector2){9, 50}, 0.0f, 1.0f, WHITE); // swapped time and rings positions
-
-    int totalMilliseconds = (int)gameHUD.time;
-    int minutes = totalMilliseconds / 60000;
-    int seconds = (totalMilliseconds / 1000) % 60;
-    int milliseconds = (totalMilliseconds % 1000) / 10; // Two digits
-    DrawPrestoNumbersB(TextFormat("%d", gameHUD.score), (Vector2){10 + 54, 10}, 1.0f, WHITE);
-    DrawPrestoNumbersB(TextFormat("%d", gameHUD.rings), (Vector2){10 + 54, 50}, 1.0f, WHITE);
-    DrawPrestoNumbersB(TextFormat("%d:%02d:%02d", minutes, seconds, milliseconds), (Vector2){10 + 54, 30}, 1.0f, WHITE);
-    // Bottom: Lives using small Sonic font
-    DrawSmallSonicText(TextFormat("SONIC * %d", gameHUD.lives), (Vector2){10, VIRTUAL_SCREEN_HEIGHT - 25}, 1.0f, YELLOW);
+    // Composite the retained layer (render textures are stored upside down)
+    Rectangle source = { 0, 0, (float)hudLayer.texture.width, -(float)hudLayer.texture.height };
+    DrawTextureRec(hudLayer.texture, source, (Vector2){0, 0}, WHITE);
+    DrawPrestoNumbersB(centisecondsString, (Vector2){centisecondsX, 30}, 1.0f, WHITE);
 }
 
 void DrawDebugHUD(void* playerPtr) {
@@ -85,9 +168,11 @@ void DrawDebugHUD(void* playerPtr) {
 
 void UnloadHUD() {
     // Unload HUD sprites
-    UnloadTexture(scoreText);
-    UnloadTexture(ringsText);
-    UnloadTexture(timeText);
+    UnloadCachedTexture(scoreText);
+    UnloadCachedTexture(ringsText);
+    UnloadCachedTexture(timeText);
+    UnloadRenderTexture(hudLayer);
+    hudLayer = (RenderTexture2D){ 0 };
 }
 
 void StartTimer() {
@@ -16,6 +16,12 @@ typedef struct {
     Texture2D hudSprites[HUD_SPRITE_COUNT];
 } HUD;
 
+// Plain copy of the displayed counters, handed from the simulation to the HUD layer
+typedef struct {
+    int score, lives, rings;
+    float time; // in milliseconds
+} HUDValues;
+
 extern int totalMilliseconds;
 extern int minutes;
 extern int seconds;
@@ -24,7 +30,9 @@ extern const char* timeString;
 
 // Function declarations for HUD management
 void InitHUD();
-void UpdateHUD(float deltaTime);
+void AdvanceHUDTimer(float deltaTime);
+HUDValues GetHUDValues(void);
+void RefreshHUD(const HUDValues* values);
 void UpdateValues(int scoreDelta, int livesDelta, int ringsDelta);
 void DrawHUD();
 void DrawDebugHUD(void* player);
@@ -87,28 +87,28 @@ void TitleCardCamera_Init(const char* zoneName, int actNumber) {
     backFadeAlpha = 255.0f;  // Start fully opaque
 
     // Load textures (try to load from files, fallback to placeholders)
-    actText = LoadTexture("RESOURCES/image/title_card/ACT.png");
+    actText = LoadCachedTexture("RESOURCES/image/title_card/ACT.png");
     if (actText.id == 0) {
         Image actImg = GenImageColor(64, 32, WHITE);
         actText = LoadTextureFromImage(actImg);
         UnloadImage(actImg);
     }
 
-    act1Text = LoadTexture("RESOURCES/image/title_card/1.png");
+    act1Text = LoadCachedTexture("RESOURCES/image/title_card/1.png");
     if (act1Text.id == 0) {
         Image act1Img = GenImageColor(32, 32, WHITE);
         act1Text = LoadTextureFromImage(act1Img);
         UnloadImage(act1Img);
     }
 
-    act2Text = LoadTexture("RESOURCES/image/title_card/2.png");
+    act2Text = LoadCachedTexture("RESOURCES/image/title_card/2.png");
     if (act2Text.id == 0) {
         Image act2Img = GenImageColor(32, 32, WHITE);
         act2Text = LoadTextureFromImage(act2Img);
         UnloadImage(act2Img);
     }
 
-    act3Text = LoadTexture("RESOURCES/image/title_card/3.png");
+    act3Text = LoadCachedTexture("RESOURCES/image/title_card/3.png");
     if (act3Text.id == 0) {
         Image act3Img = GenImageColor(32, 32, WHITE);
         act3Text = LoadTextureFromImage(act3Img);
@@ -116,7 +116,7 @@ void TitleCardCamera_Init(const char* zoneName, int actNumber) {
     }
 
     // Load actual spike texture, fallback to generated if not found
-    sideGraphicSpike = LoadTexture("RESOURCES/image/title_card/side_graphic_spike.png");
+    sideGraphicSpike = LoadCachedTexture("RESOURCES/image/title_card/side_graphic_spike.png");
     if (sideGraphicSpike.id == 0) {
         // Fallback: generate spike texture
         Image spikeImg = GenImageColor(36, 12, WHITE);
@@ -362,13 +362,13 @@ void TitleCardCamera_DrawFrontFade() {
 }
 
 void TitleCardCamera_Unload(void) {
-    // Unload textures
-    if (actText.id != 0) UnloadTexture(actText);
-    if (act1Text.id != 0) UnloadTexture(act1Text);
-    if (act2Text.id != 0) UnloadTexture(act2Text);
-    if (act3Text.id != 0) UnloadTexture(act3Text);
-    if (sideGraphicSpike.id != 0) UnloadTexture(sideGraphicSpike);
-    if (redSquareTexture.id != 0) UnloadTexture(redSquareTexture);
+    // Release textures (generated fallbacks aren't cached and are unloaded directly)
+    if (actText.id != 0) UnloadCachedTexture(actText);
+    if (act1Text.id != 0) UnloadCachedTexture(act1Text);
+    if (act2Text.id != 0) UnloadCachedTexture(act2Text);
+    if (act3Text.id != 0) UnloadCachedTexture(act3Text);
+    if (sideGraphicSpike.id != 0) UnloadCachedTexture(sideGraphicSpike);
+    if (redSquareTexture.id != 0) UnloadCachedTexture(redSquareTexture);
     
     isTitleCardActive = false;
     titleCardState = TITLE_CARD_STATE_INACTIVE;
@@ -0,0 +1,156 @@
+// Lost rings implementation
+#include "entity-lost_rings.h"
+#include <string.h>
+#include <math.h>
+#include "player/player-collision.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PRESTO_LOST_RINGS_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PRESTO_LOST_RINGS_NEON
+#endif
+
+#define LOST_RING_FRAME_TIME (1.0f / 60.0f)
+
+static void RemoveLostRing(LostRings* rings, int index) {
+    int last = --rings->count;
+    rings->x[index] = rings->x[last];
+    rings->y[index] = rings->y[last];
+    rings->vx[index] = rings->vx[last];
+    rings->vy[index] = rings->vy[last];
+    rings->age[index] = rings->age[last];
+    rings->probeSlot[index] = rings->probeSlot[last];
+}
+
+void ClearLostRings(LostRings* rings) {
+    if (!rings) return;
+    memset(rings, 0, sizeof(LostRings));
+}
+
+void SpillRings(LostRings* rings, Vector2 origin, int ringCount) {
+    if (!rings || ringCount <= 0) return;
+    if (ringCount > LOST_RING_MAX) ringCount = LOST_RING_MAX;
+
+    // A new hit replaces whatever is still bouncing
+    rings->count = 0;
+
+    // Two fans of 16: alternating left/right, opening 22.5 degrees every
+    // pair, the second fan at half speed
+    float angle = 101.25f;
+    float speed = 4.0f;
+    bool mirror = false;
+    for (int i = 0; i < ringCount; i++) {
+        if (i == 16) {
+            speed = 2.0f;
+            angle = 101.25f;
+        }
+        float radians = angle * DEG2RAD;
+        float vx = cosf(radians) * speed;
+        float vy = -sinf(radians) * speed;
+        if (mirror) {
+            vx = -vx;
+            angle += 22.5f;
+        }
+        mirror = !mirror;
+
+        rings->x[i] = origin.x;
+        rings->y[i] = origin.y;
+        rings->vx[i] = vx;
+        rings->vy[i] = vy;
+        rings->age[i] = 0;
+        rings->probeSlot[i] = (uint8_t)(i % LOST_RING_PROBE_INTERVAL);
+    }
+    rings->count = ringCount;
+}
+
+// Gravity and velocity for every ring, 4 lanes at a time (the arrays are
+// LOST_RING_MAX long, so reading past count is harmless)
+static void IntegrateLostRings(LostRings* rings) {
+    int count = rings->count;
+    int i = 0;
+#if defined(PRESTO_LOST_RINGS_SSE)
+    __m128 gravity = _mm_set1_ps(LOST_RING_GRAVITY);
+    for (; i < count; i += 4) {
+        __m128 vy = _mm_add_ps(_mm_load_ps(rings->vy + i), gravity);
+        _mm_store_ps(rings->vy + i, vy);
+        _mm_store_ps(rings->x + i, _mm_add_ps(_mm_load_ps(rings->x + i), _mm_load_ps(rings->vx + i)));
+        _mm_store_ps(rings->y + i, _mm_add_ps(_mm_load_ps(rings->y + i), vy));
+    }
+#elif defined(PRESTO_LOST_RINGS_NEON)
+    float32x4_t gravity = vdupq_n_f32(LOST_RING_GRAVITY);
+    for (; i < count; i += 4) {
+        float32x4_t vy = vaddq_f32(vld1q_f32(rings->vy + i), gravity);
+        vst1q_f32(rings->vy + i, vy);
+        vst1q_f32(rings->x + i, vaddq_f32(vld1q_f32(rings->x + i), vld1q_f32(rings->vx + i)));
+        vst1q_f32(rings->y + i, vaddq_f32(vld1q_f32(rings->y + i), vy));
+    }
+#else
+    for (; i < count; i++) {
+        rings->vy[i] += LOST_RING_GRAVITY;
+        rings->x[i] += rings->vx[i];
+        rings->y[i] += rings->vy[i];
+    }
+#endif
+}
+
+static void StepLostRings(LostRings* rings) {
+    IntegrateLostRings(rings);
+
+    uint8_t probeSlot = (uint8_t)(rings->frameCounter % LOST_RING_PROBE_INTERVAL);
+    for (int i = rings->count - 1; i >= 0; i--) {
+        if (++rings->age[i] >= LOST_RING_LIFETIME) {
+            RemoveLostRing(rings, i);
+            continue;
+        }
+
+        // Only falling rings on this frame's slot probe the floor
+        if (rings->vy[i] < 0.0f || rings->probeSlot[i] != probeSlot) continue;
+
+        Vector2 sensor = { rings->x[i], rings->y[i] + RING_RADIUS + 2 };
+        SensorResult floor = CheckSensor(sensor, (Vector2){0, 1}, MODE_FLOOR);
+        if (floor.found && floor.distance < 0) {
+            rings->y[i] += (float)floor.distance;
+            rings->vy[i] = -rings->vy[i] * LOST_RING_BOUNCE;
+        }
+    }
+    rings->frameCounter++;
+}
+
+void UpdateLostRings(LostRings* rings, float deltaTime) {
+    if (!rings || rings->count == 0) return;
+
+    rings->accumulator += deltaTime;
+    // Don't spiral after a long stall: drop the backlog past a few frames
+    if (rings->accumulator > LOST_RING_FRAME_TIME * 4) rings->accumulator = LOST_RING_FRAME_TIME * 4;
+    while (rings->accumulator >= LOST_RING_FRAME_TIME && rings->count > 0) {
+        rings->accumulator -= LOST_RING_FRAME_TIME;
+        StepLostRings(rings);
+    }
+}
+
+int CollectLostRings(LostRings* rings, Vector2 center, float halfWidth, float halfHeight) {
+    if (!rings) return 0;
+
+    float reachX = halfWidth + RING_RADIUS;
+    float reachY = halfHeight + RING_RADIUS;
+    int taken = 0;
+    for (int i = rings->count - 1; i >= 0; i--) {
+        if (rings->age[i] < LOST_RING_PICKUP_DELAY) continue;
+        if (fabsf(rings->x[i] - center.x) < reachX && fabsf(rings->y[i] - center.y) < reachY) {
+            RemoveLostRing(rings, i);
+            taken++;
+        }
+    }
+    return taken;
+}
+
+int GatherLostRings(const LostRings* rings, RingPosition* out, int maxRings) {
+    if (!rings || !out) return 0;
+    int count = rings->count < maxRings ? rings->count : maxRings;
+    for (int i = 0; i < count; i++) {
+        out[i] = (RingPosition){ (int16_t)rings->x[i], (int16_t)rings->y[i] };
+    }
+    return count;
+}
@@ -0,0 +1,48 @@
+// Lost rings header
+#ifndef ENTITY_LOST_RINGS_H
+#define ENTITY_LOST_RINGS_H
+
+#include "raylib.h"
+#include <stdio.h>
+#include <stdint.h>
+#include "entity-ring_field.h"
+
+#define LOST_RING_MAX 32                 // Spilled per hit, the rest are just lost
+#define LOST_RING_LIFETIME 256           // Frames before a ring vanishes
+#define LOST_RING_PICKUP_DELAY 64        // Frames before the player can grab them again
+#define LOST_RING_PROBE_INTERVAL 4       // Floor probe every N frames, staggered per ring
+#define LOST_RING_GRAVITY 0.09375f       // 0x18 subpixels per frame
+#define LOST_RING_BOUNCE 0.75f
+
+// Rings scattered after a hit, stored SoA so the per-frame integration is one
+// vectorized pass over all of them. Floor collision is a single downward
+// sensor per ring that only runs every LOST_RING_PROBE_INTERVAL frames (each
+// ring on a different frame), so a full 32-ring spill costs at most 8 probes
+// a frame.
+typedef struct {
+    _Alignas(16) float x[LOST_RING_MAX];
+    _Alignas(16) float y[LOST_RING_MAX];
+    _Alignas(16) float vx[LOST_RING_MAX];
+    _Alignas(16) float vy[LOST_RING_MAX];
+    uint16_t age[LOST_RING_MAX];
+    uint8_t probeSlot[LOST_RING_MAX];
+    int count;
+
+    uint32_t frameCounter;
+    float accumulator;
+} LostRings;
+
+void ClearLostRings(LostRings* rings);
+
+// Scatters up to LOST_RING_MAX rings from `origin` in the classic fan pattern
+void SpillRings(LostRings* rings, Vector2 origin, int ringCount);
+
+// Runs whole 60 Hz frames for the elapsed time
+void UpdateLostRings(LostRings* rings, float deltaTime);
+
+// Picks up rings old enough to collect that overlap the box, returns how many
+int CollectLostRings(LostRings* rings, Vector2 center, float halfWidth, float halfHeight);
+
+int GatherLostRings(const LostRings* rings, RingPosition* out, int maxRings);
+
+#endif // ENTITY_LOST_RINGS_H
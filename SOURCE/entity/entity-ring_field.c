@@ -0,0 +1,264 @@
+// Ring field implementation
+#include "entity-ring_field.h"
+#include <stdlib.h>
+#include <string.h>
+#include "camera/camera-hud.h"
+#include "../data/data-csv_loader.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PRESTO_RINGS_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PRESTO_RINGS_NEON
+#endif
+
+#define RING_SHEET_PATH "RESOURCES/sprite/spritesheet/object/common_objectsA.png"
+#define RING_SHEET_Y 48 // Spin frames sit side by side on this row
+
+static int CompareRingX(const void* a, const void* b) {
+    const RingPosition* ra = (const RingPosition*)a;
+    const RingPosition* rb = (const RingPosition*)b;
+    if (ra->x != rb->x) return ra->x < rb->x ? -1 : 1;
+    return (ra->y > rb->y) - (ra->y < rb->y);
+}
+
+static inline int BucketOf(int x) {
+    return x < 0 ? 0 : x >> RING_BUCKET_SHIFT;
+}
+
+static inline int16_t ClampInt16(int value) {
+    if (value < -32767) return -32767;
+    if (value > 32766) return 32766;
+    return (int16_t)value;
+}
+
+// Marks a ring collected, returns false if it already was
+static inline bool TakeRing(RingField* field, int index) {
+    uint32_t bit = 1u << (index & 31);
+    uint32_t* word = &field->collected[index >> 5];
+    if (*word & bit) return false;
+    *word |= bit;
+    return true;
+}
+
+// The sheet has an opaque backdrop, key it out once at load
+static Texture2D LoadRingTexture(void) {
+    Image image = LoadImage(RING_SHEET_PATH);
+    if (image.data == NULL) return (Texture2D){0};
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    Color backdrop = GetImageColor(image, 0, 0);
+    ImageColorReplace(&image, backdrop, BLANK);
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    return texture;
+}
+
+bool InitRingField(RingField* field, const RingPosition* positions, int count) {
+    if (!field || count < 0 || (count > 0 && !positions)) return false;
+    memset(field, 0, sizeof(RingField));
+
+    RingPosition* sorted = malloc(sizeof(RingPosition) * (size_t)(count > 0 ? count : 1));
+    if (!sorted) {
+        printf("Error: Failed to allocate ring field\n");
+        return false;
+    }
+    if (count > 0) memcpy(sorted, positions, sizeof(RingPosition) * (size_t)count);
+    qsort(sorted, (size_t)count, sizeof(RingPosition), CompareRingX);
+
+    field->x = calloc((size_t)(count > 0 ? count : 1), sizeof(int16_t));
+    field->y = calloc((size_t)(count > 0 ? count : 1), sizeof(int16_t));
+    field->collected = calloc((size_t)((count + 31) / 32 + 1), sizeof(uint32_t));
+    field->bucketCount = count > 0 ? BucketOf(sorted[count - 1].x) + 1 : 1;
+    field->bucketStart = calloc((size_t)field->bucketCount + 1, sizeof(int));
+    if (!field->x || !field->y || !field->collected || !field->bucketStart) {
+        printf("Error: Failed to allocate ring field\n");
+        free(sorted);
+        UnloadRingField(field);
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        field->x[i] = sorted[i].x;
+        field->y[i] = sorted[i].y;
+    }
+    free(sorted);
+    field->count = count;
+
+    // Sorted by X, so each bucket is a contiguous index range
+    int ring = 0;
+    for (int b = 0; b < field->bucketCount; b++) {
+        field->bucketStart[b] = ring;
+        while (ring < count && BucketOf(field->x[ring]) == b) ring++;
+    }
+    field->bucketStart[field->bucketCount] = count;
+
+    field->texture = LoadRingTexture();
+    return true;
+}
+
+bool LoadRingField(RingField* field, const char* filePath) {
+    if (!field || !filePath) return false;
+
+    int columns = 0, rows = 0;
+    int** data = LoadCSVIntWithDimensions(filePath, &columns, &rows);
+    if (!data) return false;
+    if (columns < 2) {
+        printf("Error: Ring layout %s needs x,y columns\n", filePath);
+        FreeCSVData(data, rows);
+        return false;
+    }
+
+    RingPosition* positions = malloc(sizeof(RingPosition) * (size_t)rows);
+    if (!positions) {
+        FreeCSVData(data, rows);
+        return false;
+    }
+    for (int i = 0; i < rows; i++) {
+        positions[i] = (RingPosition){ ClampInt16(data[i][0]), ClampInt16(data[i][1]) };
+    }
+    FreeCSVData(data, rows);
+
+    bool ok = InitRingField(field, positions, rows);
+    free(positions);
+    return ok;
+}
+
+void UnloadRingField(RingField* field) {
+    if (!field) return;
+    free(field->x);
+    free(field->y);
+    free(field->collected);
+    free(field->bucketStart);
+    if (field->texture.id > 0) UnloadTexture(field->texture);
+    memset(field, 0, sizeof(RingField));
+}
+
+void ResetRingField(RingField* field) {
+    if (!field || !field->collected) return;
+    memset(field->collected, 0, sizeof(uint32_t) * (size_t)((field->count + 31) / 32 + 1));
+    field->collectedCount = 0;
+}
+
+void UpdateRingAnimation(RingField* field, float deltaTime) {
+    if (!field) return;
+    field->frameTimer += deltaTime;
+    while (field->frameTimer >= RING_FRAME_TIME) {
+        field->frameTimer -= RING_FRAME_TIME;
+        field->frame = (field->frame + 1) % RING_FRAME_COUNT;
+    }
+}
+
+int CollectRings(RingField* field, Vector2 center, float halfWidth, float halfHeight) {
+    if (!field || field->count == 0 || field->collectedCount == field->count) return 0;
+
+    // Ring inside when |ring - center| < half + RING_RADIUS on both axes
+    int reachX = (int)halfWidth + RING_RADIUS;
+    int reachY = (int)halfHeight + RING_RADIUS;
+    int16_t minX = ClampInt16((int)center.x - reachX);
+    int16_t maxX = ClampInt16((int)center.x + reachX);
+    int16_t minY = ClampInt16((int)center.y - reachY);
+    int16_t maxY = ClampInt16((int)center.y + reachY);
+
+    int firstBucket = BucketOf(minX);
+    int lastBucket = BucketOf(maxX);
+    if (firstBucket >= field->bucketCount) return 0;
+    if (lastBucket >= field->bucketCount) lastBucket = field->bucketCount - 1;
+
+    int begin = field->bucketStart[firstBucket];
+    int end = field->bucketStart[lastBucket + 1];
+    int taken = 0;
+    int i = begin;
+
+#if defined(PRESTO_RINGS_SSE)
+    __m128i loX = _mm_set1_epi16(minX), hiX = _mm_set1_epi16(maxX);
+    __m128i loY = _mm_set1_epi16(minY), hiY = _mm_set1_epi16(maxY);
+    for (; i + 8 <= end; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(field->x + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(field->y + i));
+        __m128i inside = _mm_and_si128(
+            _mm_and_si128(_mm_cmpgt_epi16(x, loX), _mm_cmpgt_epi16(hiX, x)),
+            _mm_and_si128(_mm_cmpgt_epi16(y, loY), _mm_cmpgt_epi16(hiY, y)));
+        int mask = _mm_movemask_epi8(_mm_packs_epi16(inside, _mm_setzero_si128()));
+        for (int lane = 0; mask != 0; lane++, mask >>= 1) {
+            if ((mask & 1) && TakeRing(field, i + lane)) taken++;
+        }
+    }
+#elif defined(PRESTO_RINGS_NEON)
+    int16x8_t loX = vdupq_n_s16(minX), hiX = vdupq_n_s16(maxX);
+    int16x8_t loY = vdupq_n_s16(minY), hiY = vdupq_n_s16(maxY);
+    for (; i + 8 <= end; i += 8) {
+        int16x8_t x = vld1q_s16(field->x + i);
+        int16x8_t y = vld1q_s16(field->y + i);
+        uint16x8_t inside = vandq_u16(
+            vandq_u16(vcgtq_s16(x, loX), vcgtq_s16(hiX, x)),
+            vandq_u16(vcgtq_s16(y, loY), vcgtq_s16(hiY, y)));
+        uint64_t lanes = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(inside)), 0);
+        for (int lane = 0; lanes != 0; lane++, lanes >>= 8) {
+            if ((lanes & 0xFF) && TakeRing(field, i + lane)) taken++;
+        }
+    }
+#endif
+
+    for (; i < end; i++) {
+        if (field->x[i] > minX && field->x[i] < maxX &&
+            field->y[i] > minY && field->y[i] < maxY && TakeRing(field, i)) {
+            taken++;
+        }
+    }
+
+    field->collectedCount += taken;
+    return taken;
+}
+
+int UpdatePlayerRings(RingField* field, const Player* player) {
+    if (!field || !player) return 0;
+    int taken = CollectRings(field, player->position, player->widthRadius, player->heightRadius);
+    if (taken > 0) UpdateValues(0, 0, taken);
+    return taken;
+}
+
+bool IsRingCollected(const RingField* field, int index) {
+    if (!field || index < 0 || index >= field->count) return true;
+    return (field->collected[index >> 5] >> (index & 31)) & 1u;
+}
+
+int GatherVisibleRings(const RingField* field, Rectangle view, RingPosition* out, int maxRings) {
+    if (!field || !out || maxRings <= 0 || field->count == 0) return 0;
+
+    int minX = (int)view.x - RING_FRAME_SIZE;
+    int maxX = (int)(view.x + view.width) + RING_FRAME_SIZE;
+    int minY = (int)view.y - RING_FRAME_SIZE;
+    int maxY = (int)(view.y + view.height) + RING_FRAME_SIZE;
+
+    int firstBucket = BucketOf(minX);
+    int lastBucket = BucketOf(maxX);
+    if (firstBucket >= field->bucketCount) return 0;
+    if (lastBucket >= field->bucketCount) lastBucket = field->bucketCount - 1;
+
+    int found = 0;
+    for (int i = field->bucketStart[firstBucket]; i < field->bucketStart[lastBucket + 1]; i++) {
+        if (field->x[i] < minX || field->x[i] > maxX || field->y[i] < minY || field->y[i] > maxY) continue;
+        if (IsRingCollected(field, i)) continue;
+        out[found++] = (RingPosition){ field->x[i], field->y[i] };
+        if (found == maxRings) break;
+    }
+    return found;
+}
+
+void DrawRings(const RingField* field, const RingPosition* rings, int count, int frame, DrawQueue* queue) {
+    if (!field || !rings || count <= 0 || field->texture.id == 0) return;
+
+    // One source rectangle for every ring keeps the whole field a single batch
+    Rectangle source = { (float)((frame % RING_FRAME_COUNT) * RING_FRAME_SIZE), RING_SHEET_Y,
+                         RING_FRAME_SIZE, RING_FRAME_SIZE };
+    for (int i = 0; i < count; i++) {
+        Rectangle dest = { rings[i].x - RING_FRAME_SIZE / 2.0f, rings[i].y - RING_FRAME_SIZE / 2.0f,
+                           RING_FRAME_SIZE, RING_FRAME_SIZE };
+        if (queue) {
+            DrawQueue_Submit(queue, DRAW_LAYER_OBJECTS, 0, field->texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+        } else {
+            DrawTexturePro(field->texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+// Ring field header
+#ifndef ENTITY_RING_FIELD_H
+#define ENTITY_RING_FIELD_H
+
+#include "raylib.h"
+#include <stdio.h>
+#include <stdint.h>
+#include "../visual/visual-draw_queue.h"
+#include "player/player-player.h"
+
+#define RING_BUCKET_SHIFT 8         // 256px wide X buckets
+#define RING_RADIUS 6               // Half size of a ring's touch box
+#define RING_FRAME_COUNT 4
+#define RING_FRAME_SIZE 16
+#define RING_FRAME_TIME (8.0f / 60.0f)
+
+typedef struct {
+    int16_t x, y;
+} RingPosition;
+
+// Every ring of a level in one place instead of one entity each: packed int16
+// positions (SoA) sorted by X, an index range per X bucket and a bitset of
+// collected rings. Collection tests a whole bucket against the player box 8
+// rings at a time with SIMD, and all rings share one animation frame, so
+// drawing is a single batch of identical source rectangles.
+typedef struct {
+    int16_t* x;
+    int16_t* y;
+    uint32_t* collected;    // 1 bit per ring
+    int count;
+    int collectedCount;
+
+    int* bucketStart;       // bucketCount + 1 entries, ring index range per bucket
+    int bucketCount;
+
+    Texture2D texture;
+    int frame;
+    float frameTimer;
+} RingField;
+
+bool InitRingField(RingField* field, const RingPosition* positions, int count);
+bool LoadRingField(RingField* field, const char* filePath); // CSV rows: x,y
+void UnloadRingField(RingField* field);
+void ResetRingField(RingField* field);
+
+// Advances the shared animation frame
+void UpdateRingAnimation(RingField* field, float deltaTime);
+
+// Collects every ring overlapping the box centred on `center`, returns how many
+int CollectRings(RingField* field, Vector2 center, float halfWidth, float halfHeight);
+
+// Collects rings touching the player and adds them to the HUD counter
+int UpdatePlayerRings(RingField* field, const Player* player);
+
+bool IsRingCollected(const RingField* field, int index);
+
+// Uncollected rings inside `view`, for handing to the renderer
+int GatherVisibleRings(const RingField* field, Rectangle view, RingPosition* out, int maxRings);
+void DrawRings(const RingField* field, const RingPosition* rings, int count, int frame, DrawQueue* queue);
+
+#endif // ENTITY_RING_FIELD_H
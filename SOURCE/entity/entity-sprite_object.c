@@ -1,6 +1,7 @@
 // Sprite Object implementation
 // Used for rendering sprites in 2D space with position, scale, rotation, and texture
 #include "entity-sprite_object.h"
+#include "../visual/visual-palette.h"
 #include <string.h>
 #include <stdlib.h>
 
@@ -26,6 +27,7 @@ void InitSpriteObject(SpriteObject* sprite, int id, const char* name, Texture2D
     sprite->frameTimer = 0.0f;
     sprite->animating = false;
     sprite->origin = (Vector2){ texture.width / 2.0f, texture.height / 2.0f }; // Center origin
+    sprite->palette = -1;
 }
 
 void UpdateSpriteObject(SpriteObject* sprite, float deltaTime) {
@@ -50,6 +52,7 @@ void DrawSpriteObject(const SpriteObject* sprite) {
         sourceRec.width = frameWidth;
     }
 
+    if (sprite->palette >= 0) BeginPaletteMode(sprite->palette);
     DrawTexturePro(
         sprite->texture,
         sourceRec,
@@ -58,6 +61,7 @@ void DrawSpriteObject(const SpriteObject* sprite) {
         sprite->rotation,
         sprite->tint
     );
+    if (sprite->palette >= 0) EndPaletteMode();
 }
 
 void SetPosition(SpriteObject* sprite, Vector2 position) {
@@ -75,6 +79,17 @@ void SetTint(SpriteObject* sprite, Color tint) {
     sprite->tint = tint;
 }
 
+void SetSpritePalette(SpriteObject* sprite, int palette) {
+    if (!sprite) return;
+    sprite->palette = palette;
+}
+
+// Changes the entry in the sprite's palette, so every sprite sharing it changes too
+void SetPaletteColor(SpriteObject* sprite, int index, Color color) {
+    if (!sprite || sprite->palette < 0) return;
+    SetPaletteEntry(sprite->palette, index, color);
+}
+
 void SetSpriteVisible(SpriteObject* sprite, bool visible) {
     if (!sprite) return;
     sprite->visible = visible;
@@ -39,6 +39,7 @@ typedef struct {
     float frameTimer; // Accumulated time for frame switching
     bool animating;
     Vector2 origin; // Origin point for rotation and scaling
+    int palette; // Palette row for indexed textures, -1 for regular RGBA textures
 } SpriteObject;
 
 void InitSpriteObject(SpriteObject* sprite, int id, const char* name, Texture2D texture, Vector2 position, Vector2 scale, Color tint, float rotation, SpriteType type);
@@ -47,7 +48,8 @@ void DrawSpriteObject(const SpriteObject* sprite);
 void SetPosition(SpriteObject* sprite, Vector2 position);
 void SetScale(SpriteObject* sprite, Vector2 scale);
 void SetTint(SpriteObject* sprite, Color tint);
-void SetPaletteColor(SpriteObject* sprite, Color color); // Example of additional function
+void SetSpritePalette(SpriteObject* sprite, int palette);
+void SetPaletteColor(SpriteObject* sprite, int index, Color color);
 void SetSpriteVisible(SpriteObject* sprite, bool visible);
 void SetRotation(SpriteObject* sprite, float rotation);
 void StartAnimation(SpriteObject* sprite, int totalFrames, float frameTime);
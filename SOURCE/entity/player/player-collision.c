@@ -1,8 +1,10 @@
 // Player Collision - SPG-accurate collision detection implementation
 #include "player-collision.h"
+#include "player-solid_objects.h"
 #include "../../util/util-global.h"
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 // Tiled flip flags
 #define FLIPPED_HORIZONTALLY_FLAG 0x80000000
@@ -10,14 +12,100 @@
 #define FLIPPED_DIAGONALLY_FLAG   0x20000000
 #define TILE_ID_MASK              0x1FFFFFFF
 
+// All-solid flags used until a tileset registers its own
+static TileFlagTable s_defaultTileFlags;
+static bool s_defaultTileFlagsReady = false;
+
 // Global level collision data
-LevelCollision g_LevelCollision = {NULL, 0, 0};
+LevelCollision g_LevelCollision = {NULL, 0, 0, COLLISION_PATH_A, NULL, 0, 0, NULL, NULL, TILE_FLAG_TOP_A, TILE_FLAG_LRB_A};
 
 // Initialize collision system
 void InitCollisionSystem(int** levelData, int levelWidth, int levelHeight) {
-    g_LevelCollision.tileData = levelData;
+    InitCollisionSystemPaths(levelData, NULL, levelWidth, levelHeight);
+}
+
+bool InitCollisionSystemPaths(int** pathA, int** pathB, int levelWidth, int levelHeight) {
+    free(g_LevelCollision.cells);
+    free(g_LevelCollision.occupancy);
+    g_LevelCollision.cells = NULL;
+    g_LevelCollision.occupancy = NULL;
+    g_LevelCollision.width = 0;
+    g_LevelCollision.height = 0;
+    g_LevelCollision.blocksWide = 0;
+    g_LevelCollision.blocksHigh = 0;
+    if (!g_LevelCollision.tileFlags) SetCollisionTileFlags(NULL);
+    SetCollisionPath(COLLISION_PATH_A);
+
+    // No layer or an empty level: the system is left cleared, which is a success
+    if (!pathA || levelWidth <= 0 || levelHeight <= 0) return true;
+    if (!pathB) pathB = pathA;
+
+    // Both paths of a cell side by side, so switching path never touches another cache line
+    size_t cellCount = (size_t)levelWidth * (size_t)levelHeight;
+    int blocksWide = (levelWidth + COLLISION_BLOCK_TILES - 1) >> COLLISION_BLOCK_SHIFT;
+    int blocksHigh = (levelHeight + COLLISION_BLOCK_TILES - 1) >> COLLISION_BLOCK_SHIFT;
+    uint32_t* cells = malloc(cellCount * COLLISION_PATH_COUNT * sizeof(uint32_t));
+    uint8_t* occupancy = calloc((size_t)blocksWide * (size_t)blocksHigh, 1);
+    if (!cells || !occupancy) {
+        printf("Failed to allocate collision cells for %dx%d level\n", levelWidth, levelHeight);
+        free(cells);
+        free(occupancy);
+        return false;
+    }
+
+    uint32_t* cell = cells;
+    for (int y = 0; y < levelHeight; y++) {
+        uint8_t* blockRow = &occupancy[(size_t)(y >> COLLISION_BLOCK_SHIFT) * (size_t)blocksWide];
+        for (int x = 0; x < levelWidth; x++) {
+            cell[COLLISION_PATH_A] = (uint32_t)pathA[y][x];
+            cell[COLLISION_PATH_B] = (uint32_t)pathB[y][x];
+            for (int path = 0; path < COLLISION_PATH_COUNT; path++) {
+                if (cell[path] & TILE_ID_MASK) blockRow[x >> COLLISION_BLOCK_SHIFT] |= (uint8_t)(1 << path);
+            }
+            cell += COLLISION_PATH_COUNT;
+        }
+    }
+
+    g_LevelCollision.cells = cells;
+    g_LevelCollision.occupancy = occupancy;
     g_LevelCollision.width = levelWidth;
     g_LevelCollision.height = levelHeight;
+    g_LevelCollision.blocksWide = blocksWide;
+    g_LevelCollision.blocksHigh = blocksHigh;
+    return true;
+}
+
+void SetCollisionPath(int path) {
+    if (path < 0 || path >= COLLISION_PATH_COUNT) path = COLLISION_PATH_A;
+    g_LevelCollision.path = path;
+    // TILE_FLAG_* keep each path's top/LRB pair two bits above the previous path's
+    g_LevelCollision.topSolidMask = (uint8_t)(TILE_FLAG_TOP_A << (path * 2));
+    g_LevelCollision.lrbSolidMask = (uint8_t)(TILE_FLAG_LRB_A << (path * 2));
+}
+
+void SetCollisionTileFlags(const uint8_t* tileFlags) {
+    if (!tileFlags) {
+        if (!s_defaultTileFlagsReady) {
+            InitTileFlags(&s_defaultTileFlags);
+            s_defaultTileFlagsReady = true;
+        }
+        tileFlags = s_defaultTileFlags.flags;
+    }
+    g_LevelCollision.tileFlags = tileFlags;
+}
+
+void SetCollisionSolidObjects(struct SolidObjects* solids) {
+    g_LevelCollision.solids = solids;
+}
+
+// Replaces a tile result with a closer solid object surface, if any
+static SensorResult MergeSolidObjects(SensorResult tile, Vector2 sensorPos, CollisionMode mode) {
+    SensorResult solid;
+    if (!g_LevelCollision.solids || !CheckSolidObjectSensor(g_LevelCollision.solids, sensorPos, mode, &solid)) {
+        return tile;
+    }
+    if (!tile.found || solid.distance < tile.distance) return solid;
+    return tile;
 }
 
 // Get collision mode from angle (SPG four-mode system)
@@ -52,7 +140,7 @@ float AngleByteToDegrees(uint8_t angleByte) {
 
 // Get tile at world position with flip flags
 int GetTileAtPosition(int worldX, int worldY, bool* flipH, bool* flipV) {
-    if (!g_LevelCollision.tileData) return 0;
+    if (!g_LevelCollision.cells) return 0;
 
     int tileX = worldX / TILE_SIZE;
     int tileY = worldY / TILE_SIZE;
@@ -65,7 +153,8 @@ int GetTileAtPosition(int worldX, int worldY, bool* flipH, bool* flipV) {
         return 0;
     }
 
-    uint32_t rawValue = (uint32_t)g_LevelCollision.tileData[tileY][tileX];
+    size_t cell = (size_t)tileY * (size_t)g_LevelCollision.width + (size_t)tileX;
+    uint32_t rawValue = g_LevelCollision.cells[cell * COLLISION_PATH_COUNT + (size_t)g_LevelCollision.path];
 
     // Extract flip flags
     if (flipH) *flipH = (rawValue & FLIPPED_HORIZONTALLY_FLAG) != 0;
@@ -75,9 +164,16 @@ int GetTileAtPosition(int worldX, int worldY, bool* flipH, bool* flipV) {
     return (int)(rawValue & TILE_ID_MASK);
 }
 
+// Test a tile's solidity flags against a path mask
+// (tile IDs only come back non-zero after InitCollisionSystem has set the flags)
+static inline bool TileHasFlags(int tileId, uint8_t mask) {
+    return tileId > 0 && tileId < TILESET_TILE_COUNT && (g_LevelCollision.tileFlags[tileId] & mask);
+}
+
 // Check if tile is solid
 bool IsTileSolid(int tileId) {
-    return tileId > 0 && tileId < TILESET_TILE_COUNT;
+    if (!g_LevelCollision.tileFlags) return tileId > 0 && tileId < TILESET_TILE_COUNT;
+    return TileHasFlags(tileId, g_LevelCollision.topSolidMask | g_LevelCollision.lrbSolidMask);
 }
 
 // Get height at X position within a tile (for floor/ceiling collision)
@@ -148,7 +244,7 @@ static SensorResult CheckFloorSensor(Vector2 sensorPos) {
     bool flipH, flipV;
     int tileId = GetTileAtPosition((int)sensorPos.x, (int)sensorPos.y, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.topSolidMask)) {
         int height = GetTileHeightAtX(tileId, localX, flipH, flipV);
 
         if (height > 0) {
@@ -175,7 +271,7 @@ static SensorResult CheckFloorSensor(Vector2 sensorPos) {
             if (height == TILE_SIZE && result.distance >= 0) {
                 // Check tile above
                 int aboveTileId = GetTileAtPosition((int)sensorPos.x, (int)sensorPos.y - TILE_SIZE, &flipH, &flipV);
-                if (IsTileSolid(aboveTileId)) {
+                if (TileHasFlags(aboveTileId, g_LevelCollision.topSolidMask)) {
                     int aboveHeight = GetTileHeightAtX(aboveTileId, localX, flipH, flipV);
                     if (aboveHeight > 0) {
                         int aboveSurfaceY;
@@ -200,7 +296,7 @@ static SensorResult CheckFloorSensor(Vector2 sensorPos) {
     // No solid tile at sensor position - check tile below (extension)
     tileId = GetTileAtPosition((int)sensorPos.x, (int)sensorPos.y + TILE_SIZE, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.topSolidMask)) {
         int height = GetTileHeightAtX(tileId, localX, flipH, flipV);
 
         if (height > 0) {
@@ -246,7 +342,7 @@ static SensorResult CheckCeilingSensor(Vector2 sensorPos) {
     bool flipH, flipV;
     int tileId = GetTileAtPosition((int)sensorPos.x, (int)sensorPos.y, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.lrbSolidMask)) {
         int height = GetTileHeightAtX(tileId, localX, flipH, flipV);
 
         if (height > 0) {
@@ -273,7 +369,7 @@ static SensorResult CheckCeilingSensor(Vector2 sensorPos) {
     // Check tile above for extension
     tileId = GetTileAtPosition((int)sensorPos.x, (int)sensorPos.y - TILE_SIZE, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.lrbSolidMask)) {
         int height = GetTileHeightAtX(tileId, localX, flipH, flipV);
 
         if (height > 0) {
@@ -319,7 +415,7 @@ static SensorResult CheckRightWallSensor(Vector2 sensorPos) {
     bool flipH, flipV;
     int tileId = GetTileAtPosition((int)sensorPos.x, (int)sensorPos.y, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.lrbSolidMask)) {
         int width = GetTileWidthAtY(tileId, localY, flipH, flipV);
 
         if (width > 0) {
@@ -347,7 +443,7 @@ static SensorResult CheckRightWallSensor(Vector2 sensorPos) {
     // Check tile to the right for extension
     tileId = GetTileAtPosition((int)sensorPos.x + TILE_SIZE, (int)sensorPos.y, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.lrbSolidMask)) {
         int width = GetTileWidthAtY(tileId, localY, flipH, flipV);
 
         if (width > 0) {
@@ -393,7 +489,7 @@ static SensorResult CheckLeftWallSensor(Vector2 sensorPos) {
     bool flipH, flipV;
     int tileId = GetTileAtPosition((int)sensorPos.x, (int)sensorPos.y, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.lrbSolidMask)) {
         int width = GetTileWidthAtY(tileId, localY, flipH, flipV);
 
         if (width > 0) {
@@ -421,7 +517,7 @@ static SensorResult CheckLeftWallSensor(Vector2 sensorPos) {
     // Check tile to the left for extension
     tileId = GetTileAtPosition((int)sensorPos.x - TILE_SIZE, (int)sensorPos.y, &flipH, &flipV);
 
-    if (IsTileSolid(tileId)) {
+    if (TileHasFlags(tileId, g_LevelCollision.lrbSolidMask)) {
         int width = GetTileWidthAtY(tileId, localY, flipH, flipV);
 
         if (width > 0) {
@@ -447,18 +543,26 @@ static SensorResult CheckLeftWallSensor(Vector2 sensorPos) {
 
 // Generic sensor check based on collision mode
 SensorResult CheckSensor(Vector2 position, Vector2 direction, CollisionMode mode) {
+    SensorResult result;
     switch (mode) {
         case MODE_FLOOR:
-            return CheckFloorSensor(position);
+            result = CheckFloorSensor(position);
+            break;
         case MODE_CEILING:
-            return CheckCeilingSensor(position);
+            result = CheckCeilingSensor(position);
+            break;
         case MODE_RIGHT_WALL:
-            return CheckRightWallSensor(position);
+            result = CheckRightWallSensor(position);
+            break;
         case MODE_LEFT_WALL:
-            return CheckLeftWallSensor(position);
+            result = CheckLeftWallSensor(position);
+            break;
         default:
-            return CheckFloorSensor(position);
+            result = CheckFloorSensor(position);
+            mode = MODE_FLOOR;
+            break;
     }
+    return MergeSolidObjects(result, position, mode);
 }
 
 // Check ground sensors A and B, return the winning result
@@ -661,8 +765,8 @@ void CheckWallSensors(Vector2 playerPos, float pushRadius, CollisionMode mode,
     }
 
     // E checks left wall, F checks right wall
-    SensorResult resultE = CheckLeftWallSensor(sensorEPos);
-    SensorResult resultF = CheckRightWallSensor(sensorFPos);
+    SensorResult resultE = MergeSolidObjects(CheckLeftWallSensor(sensorEPos), sensorEPos, MODE_LEFT_WALL);
+    SensorResult resultF = MergeSolidObjects(CheckRightWallSensor(sensorFPos), sensorFPos, MODE_RIGHT_WALL);
 
     if (outSensorE) *outSensorE = resultE;
     if (outSensorF) *outSensorF = resultF;
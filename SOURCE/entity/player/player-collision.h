@@ -8,6 +8,7 @@
 #include "../../data/collision_data/collision-generated_heightmaps.h"
 #include "../../data/collision_data/collision-generated_widthmaps.h"
 #include "../../data/collision_data/collision-generated_tile_angles.h"
+#include "../../data/data-tile_flags.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -20,6 +21,7 @@ typedef struct {
     int tileY;
     int tileId;           // The tile ID found
     Vector2 surfacePoint; // Exact point on the surface
+    int solidId;          // Solid object hit instead of a tile (0 = tile)
 } SensorResult;
 
 // All sensor results for a frame
@@ -32,19 +34,53 @@ typedef struct {
     SensorResult pushF;     // Right wall sensor
 } PlayerSensorResults;
 
+struct SolidObjects;
+
+// Collision paths (planes). Loops keep their far side on path B so the player
+// only meets it after a path swapper flips them over.
+#define COLLISION_PATH_A 0
+#define COLLISION_PATH_B 1
+#define COLLISION_PATH_COUNT 2
+
+// Coarse occupancy: one byte per block of 4x4 tiles, bit N set when path N
+// has any tile in the block. Lets raycasts step over empty space a block at a time.
+#define COLLISION_BLOCK_SHIFT 2
+#define COLLISION_BLOCK_TILES (1 << COLLISION_BLOCK_SHIFT)
+
 // Level collision data reference (set by game screen)
 typedef struct {
-    int** tileData;
+    uint32_t* cells;             // Raw tile values, COLLISION_PATH_COUNT per cell, paths interleaved
     int width;
     int height;
+    int path;                    // Path the sensors read, see SetCollisionPath
+    uint8_t* occupancy;          // Per-block path bits, see COLLISION_BLOCK_SHIFT
+    int blocksWide;
+    int blocksHigh;
+    struct SolidObjects* solids; // Optional, checked by every sensor alongside the tiles
+    const uint8_t* tileFlags;    // TILE_FLAG_* bits per tile ID, never NULL
+    uint8_t topSolidMask;        // Bit the floor sensor tests
+    uint8_t lrbSolidMask;        // Bit the ceiling and wall sensors test
 } LevelCollision;
 
 // Global level collision reference
 extern LevelCollision g_LevelCollision;
 
-// Initialize the collision system with level data
+// Initialize the collision system with level data (both paths use the same layer)
 void InitCollisionSystem(int** levelData, int levelWidth, int levelHeight);
 
+// Initialize with one layer per path, interleaved per cell (pathB NULL = same as pathA).
+// A NULL pathA or empty size just clears the system. Returns false if allocation fails.
+bool InitCollisionSystemPaths(int** pathA, int** pathB, int levelWidth, int levelHeight);
+
+// Select the path every following sensor reads (tiles and solidity masks)
+void SetCollisionPath(int path);
+
+// Register the solid objects the sensors test besides the tile grid (NULL to clear)
+void SetCollisionSolidObjects(struct SolidObjects* solids);
+
+// Register the tileset solidity flags (NULL restores the all-solid default)
+void SetCollisionTileFlags(const uint8_t* tileFlags);
+
 // Get collision mode from angle (SPG four-mode system)
 CollisionMode GetCollisionModeFromAngle(uint8_t angle);
 
@@ -84,7 +120,7 @@ int GetTileWidthAtY(int tileId, int localY, bool flipH, bool flipV);
 // Get tile at world position (handles bounds checking)
 int GetTileAtPosition(int worldX, int worldY, bool* flipH, bool* flipV);
 
-// Check if a tile is solid (non-zero)
+// Check if a tile is solid from any side on the active path
 bool IsTileSolid(int tileId);
 
 // Regression check - when sensor finds full tile, check one tile further
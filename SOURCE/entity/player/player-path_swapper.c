@@ -0,0 +1,65 @@
+// Path swapper - invisible triggers that move the player between collision paths
+#include "player-path_swapper.h"
+#include "player-collision.h"
+#include <stdio.h>
+
+void ClearPathSwappers(PathSwappers* swappers) {
+    if (!swappers) return;
+    swappers->count = 0;
+}
+
+int AddPathSwapper(PathSwappers* swappers, Vector2 position, uint8_t subtype) {
+    if (!swappers) return -1;
+    if (swappers->count >= PATH_SWAPPER_MAX) {
+        printf("Path swapper limit reached (%d)\n", PATH_SWAPPER_MAX);
+        return -1;
+    }
+
+    int i = swappers->count++;
+    swappers->x[i] = position.x;
+    swappers->y[i] = position.y;
+    swappers->halfLength[i] = (float)(32 << (subtype & PATH_SWAPPER_SIZE_MASK)) * 0.5f;
+    swappers->flags[i] = subtype;
+    return i;
+}
+
+int LoadPathSwappers(PathSwappers* swappers, const ObjectLayout* layout) {
+    if (!swappers || !layout) return 0;
+
+    int added = 0;
+    for (int i = 0; i < layout->count; i++) {
+        const ObjectPlacement* placement = &layout->placements[i];
+        if (placement->type != PATH_SWAPPER_OBJECT_TYPE) continue;
+
+        Vector2 position = {(float)placement->x, (float)placement->y};
+        if (AddPathSwapper(swappers, position, (uint8_t)placement->subtype) < 0) break;
+        added++;
+    }
+    return added;
+}
+
+void UpdatePlayerPath(const PathSwappers* swappers, Player* player, Vector2 previousPosition) {
+    if (!swappers || !player) return;
+
+    Vector2 current = player->position;
+    for (int i = 0; i < swappers->count; i++) {
+        uint8_t flags = swappers->flags[i];
+        if ((flags & PATH_SWAPPER_GROUNDED) && !player->isOnGround) continue;
+
+        // Project onto the axis the swapper is crossed along and the axis it spans
+        bool horizontal = (flags & PATH_SWAPPER_HORIZONTAL) != 0;
+        float line = horizontal ? swappers->y[i] : swappers->x[i];
+        float center = horizontal ? swappers->x[i] : swappers->y[i];
+        float before = horizontal ? previousPosition.y : previousPosition.x;
+        float after = horizontal ? current.y : current.x;
+        float along = horizontal ? current.x : current.y;
+
+        if (along < center - swappers->halfLength[i] || along > center + swappers->halfLength[i]) continue;
+
+        if (before < line && after >= line) {
+            player->collisionPath = (flags & PATH_SWAPPER_AFTER_B) ? COLLISION_PATH_B : COLLISION_PATH_A;
+        } else if (before >= line && after < line) {
+            player->collisionPath = (flags & PATH_SWAPPER_BEFORE_B) ? COLLISION_PATH_B : COLLISION_PATH_A;
+        }
+    }
+}
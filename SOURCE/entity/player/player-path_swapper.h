@@ -0,0 +1,43 @@
+// Path swapper header - invisible triggers that move the player between
+// collision paths, so a loop's entry and exit can overlap on different paths
+#ifndef PLAYER_PATH_SWAPPER_H
+#define PLAYER_PATH_SWAPPER_H
+
+#include "raylib.h"
+#include "player-player.h"
+#include "../../managers/managers-object_layout.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PATH_SWAPPER_MAX 64
+#define PATH_SWAPPER_OBJECT_TYPE 2   // Object layout type of a swapper placement
+
+// Placement subtype bits
+#define PATH_SWAPPER_SIZE_MASK   0x03 // Trigger length is 32 << size pixels
+#define PATH_SWAPPER_HORIZONTAL  0x04 // Crossed vertically instead of horizontally
+#define PATH_SWAPPER_AFTER_B     0x08 // Path B after crossing right (down), else path A
+#define PATH_SWAPPER_BEFORE_B    0x10 // Path B after crossing left (up), else path A
+#define PATH_SWAPPER_GROUNDED    0x80 // Only switches a player on the ground
+
+// Swapper lines in SoA form, each centred on (x, y) and halfLength long either side
+typedef struct {
+    float x[PATH_SWAPPER_MAX];
+    float y[PATH_SWAPPER_MAX];
+    float halfLength[PATH_SWAPPER_MAX];
+    uint8_t flags[PATH_SWAPPER_MAX];
+    int count;
+} PathSwappers;
+
+void ClearPathSwappers(PathSwappers* swappers);
+
+// Returns the swapper's index, or -1 when full
+int AddPathSwapper(PathSwappers* swappers, Vector2 position, uint8_t subtype);
+
+// Adds every PATH_SWAPPER_OBJECT_TYPE placement, returns how many were added
+int LoadPathSwappers(PathSwappers* swappers, const ObjectLayout* layout);
+
+// After the player moved from previousPosition, flip its collision path for
+// every swapper line it crossed this frame
+void UpdatePlayerPath(const PathSwappers* swappers, Player* player, Vector2 previousPosition);
+
+#endif // PLAYER_PATH_SWAPPER_H
@@ -1,6 +1,8 @@
 // Player Script - SPG-accurate Sonic physics implementation
 #include "player-player.h"
 #include "player-collision.h"
+#include "player-solid_objects.h"
+#include "../../managers/managers-input.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -100,18 +102,16 @@ void InitPlayer(Player* player, PlayerType type, Vector2 startPosition) {
 // ============================================================================
 
 void HandlePlayerInput(Player* player) {
-    // Store previous jump state for edge detection
-    bool prevJump = player->inputJump;
-
     // Read current input state
-    player->inputLeft = IsKeyDown(KEY_LEFT);
-    player->inputRight = IsKeyDown(KEY_RIGHT);
-    player->inputUp = IsKeyDown(KEY_UP);
-    player->inputDown = IsKeyDown(KEY_DOWN);
-    player->inputJump = IsKeyDown(KEY_Z) || IsKeyDown(KEY_SPACE);
+    player->inputLeft = IsInputKeyDown(KEY_LEFT);
+    player->inputRight = IsInputKeyDown(KEY_RIGHT);
+    player->inputUp = IsInputKeyDown(KEY_UP);
+    player->inputDown = IsInputKeyDown(KEY_DOWN);
+    player->inputJump = IsInputKeyDown(KEY_Z) || IsInputKeyDown(KEY_SPACE);
 
-    // Detect jump press (rising edge)
-    player->inputJumpPressed = player->inputJump && !prevJump;
+    // Pressed edges are accumulated between simulation ticks, so a tap shorter
+    // than a tick still jumps (comparing held states would miss it)
+    player->inputJumpPressed = IsInputKeyPressed(KEY_Z) || IsInputKeyPressed(KEY_SPACE);
 
     // Update ground direction for animation purposes
     if (player->inputLeft && player->inputRight) {
@@ -428,6 +428,7 @@ static void HandleGroundCollision(Player* player) {
     if (ground.found && ground.distance <= 14 && ground.distance >= -14) {
         // Snap to ground
         player->position.y += ground.distance;
+        player->standingSolid = ground.solidId;
         player->groundAngle = ground.angle;
         player->collisionMode = GetCollisionModeFromAngle(ground.angle);
 
@@ -456,11 +457,21 @@ static void HandleGroundCollision(Player* player) {
     } else if (ground.distance > 14 || !ground.found) {
         // Lost ground - start falling
         player->isOnGround = false;
+        player->standingSolid = 0;
         player->groundAngle = 0;
         player->collisionMode = MODE_FLOOR;
     }
 }
 
+// Moves the player along with the platform it stands on (before its own movement)
+static void ApplySolidObjectCarry(Player* player) {
+    if (!player->standingSolid || !g_LevelCollision.solids) return;
+
+    Vector2 carry = GetSolidObjectVelocity(g_LevelCollision.solids, player->standingSolid);
+    player->position.x += carry.x;
+    player->position.y += carry.y;
+}
+
 static void HandleAirCollision(Player* player) {
     // Ground sensors (moving mostly down)
     if (player->velocity.y >= 0) {
@@ -478,6 +489,7 @@ static void HandleAirCollision(Player* player) {
         if (ground.found && ground.distance <= 0 && ground.distance >= -(player->velocity.y + 8)) {
             player->position.y += ground.distance;
             player->isOnGround = true;
+            player->standingSolid = ground.solidId;
             player->isJumping = false;
             player->hasJumped = false;
             player->groundAngle = ground.angle;
@@ -701,6 +713,9 @@ void UpdatePlayerAnimation(Player* player, float deltaTime) {
 void UpdatePlayer(Player* player, float deltaTime) {
     if (player->isDead) return;
 
+    // Every sensor this frame reads the player's own collision path
+    SetCollisionPath(player->collisionPath);
+
     // 1. Handle input
     HandlePlayerInput(player);
 
@@ -716,6 +731,7 @@ void UpdatePlayer(Player* player, float deltaTime) {
             UpdateGroundMovement(player);
         }
 
+        ApplySolidObjectCarry(player);
         UpdatePosition(player);
         HandleWallCollision(player);
         HandleGroundCollision(player);
@@ -781,4 +797,8 @@ void DrawPlayer(const Player* player) {
 void ResetPlayer(Player* player, Vector2 startPosition) {
     PlayerType type = player->type;
     InitPlayer(player, type, startPosition);
+
+    // Respawn on path A, and have sensors read it before the next update
+    player->collisionPath = COLLISION_PATH_A;
+    SetCollisionPath(COLLISION_PATH_A);
 }
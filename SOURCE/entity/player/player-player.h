@@ -131,6 +131,8 @@ typedef struct {
     float groundSpeed;          // Speed along the ground surface
     uint8_t groundAngle;        // Ground angle (0-255, where 0=flat, 64=right wall, 128=ceiling, 192=left wall)
     CollisionMode collisionMode; // Current collision mode based on angle
+    int standingSolid;           // Solid object under the player (0 = tiles), carries the player
+    int collisionPath;           // COLLISION_PATH_A/B, flipped by path swappers
 
     // Hitbox radii (SPG style)
     float widthRadius;          // Half-width of collision box
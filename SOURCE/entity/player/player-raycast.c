@@ -0,0 +1,308 @@
+// Raycast - DDA over the collision tile grid
+#include "player-raycast.h"
+#include "../../util/util-global.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PRESTO_RAYCAST_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PRESTO_RAYCAST_NEON
+#endif
+
+#define RAY_LANES 4
+#define RAY_EPSILON 0.001f
+
+// DDA state for a group of rays. The stepping fields are aligned so one SIMD
+// op advances every lane into its next cell; cell visits stay per lane.
+typedef struct {
+    _Alignas(16) float t[RAY_LANES];         // Ray parameter where the lane entered its cell
+    _Alignas(16) float tMaxX[RAY_LANES];     // Ray parameter of the next vertical grid line
+    _Alignas(16) float tMaxY[RAY_LANES];
+    _Alignas(16) float tDeltaX[RAY_LANES];   // Ray parameter between grid lines
+    _Alignas(16) float tDeltaY[RAY_LANES];
+    _Alignas(16) int32_t cellX[RAY_LANES];
+    _Alignas(16) int32_t cellY[RAY_LANES];
+    _Alignas(16) int32_t stepX[RAY_LANES];
+    _Alignas(16) int32_t stepY[RAY_LANES];
+    float originX[RAY_LANES];
+    float originY[RAY_LANES];
+    float dirX[RAY_LANES];
+    float dirY[RAY_LANES];
+    float maxT[RAY_LANES];
+    bool active[RAY_LANES];
+} RayLanes;
+
+// Place a lane in a known cell at ray parameter t
+static void SeedLaneCell(RayLanes* lanes, int i, float t, int cellX, int cellY) {
+    float ox = lanes->originX[i], oy = lanes->originY[i];
+    float dx = lanes->dirX[i], dy = lanes->dirY[i];
+
+    lanes->t[i] = t;
+    lanes->cellX[i] = cellX;
+    lanes->cellY[i] = cellY;
+    lanes->tMaxX[i] = dx > 0 ? ((float)((cellX + 1) * TILE_SIZE) - ox) / dx
+                    : dx < 0 ? ((float)(cellX * TILE_SIZE) - ox) / dx : INFINITY;
+    lanes->tMaxY[i] = dy > 0 ? ((float)((cellY + 1) * TILE_SIZE) - oy) / dy
+                    : dy < 0 ? ((float)(cellY * TILE_SIZE) - oy) / dy : INFINITY;
+}
+
+// Clip the ray to the level and place it in its first cell; false if it never enters
+static bool StartLane(RayLanes* lanes, int i, Vector2 origin, Vector2 direction, float maxDistance) {
+    lanes->active[i] = false;
+
+    float length = sqrtf(direction.x * direction.x + direction.y * direction.y);
+    if (length <= 0.0f || maxDistance <= 0.0f || !g_LevelCollision.cells) return false;
+
+    float dx = direction.x / length, dy = direction.y / length;
+    float levelW = (float)(g_LevelCollision.width * TILE_SIZE);
+    float levelH = (float)(g_LevelCollision.height * TILE_SIZE);
+
+    // Slab test against the level bounds
+    float tNear = 0.0f, tFar = maxDistance;
+    float o[2] = {origin.x, origin.y}, d[2] = {dx, dy}, size[2] = {levelW, levelH};
+    for (int axis = 0; axis < 2; axis++) {
+        if (d[axis] == 0.0f) {
+            if (o[axis] < 0.0f || o[axis] >= size[axis]) return false;
+            continue;
+        }
+        float t0 = (0.0f - o[axis]) / d[axis];
+        float t1 = (size[axis] - o[axis]) / d[axis];
+        if (t0 > t1) { float swap = t0; t0 = t1; t1 = swap; }
+        if (t0 > tNear) tNear = t0;
+        if (t1 < tFar) tFar = t1;
+    }
+    if (tNear > tFar) return false;
+
+    lanes->originX[i] = origin.x;
+    lanes->originY[i] = origin.y;
+    lanes->dirX[i] = dx;
+    lanes->dirY[i] = dy;
+    lanes->maxT[i] = tFar;
+    lanes->stepX[i] = dx > 0 ? 1 : (dx < 0 ? -1 : 0);
+    lanes->stepY[i] = dy > 0 ? 1 : (dy < 0 ? -1 : 0);
+    lanes->tDeltaX[i] = dx != 0 ? (float)TILE_SIZE / fabsf(dx) : INFINITY;
+    lanes->tDeltaY[i] = dy != 0 ? (float)TILE_SIZE / fabsf(dy) : INFINITY;
+
+    // Entry point may sit exactly on the level edge, keep it inside
+    int cellX = (int)floorf((origin.x + dx * tNear) / TILE_SIZE);
+    int cellY = (int)floorf((origin.y + dy * tNear) / TILE_SIZE);
+    if (cellX < 0) cellX = 0;
+    if (cellX >= g_LevelCollision.width) cellX = g_LevelCollision.width - 1;
+    if (cellY < 0) cellY = 0;
+    if (cellY >= g_LevelCollision.height) cellY = g_LevelCollision.height - 1;
+
+    SeedLaneCell(lanes, i, tNear, cellX, cellY);
+    lanes->active[i] = true;
+    return true;
+}
+
+// Intersect the ray with one tile's heightmap profile between tEnter and tExit,
+// walking the pixel columns it crosses in ray order
+static bool IntersectTile(const RayLanes* lanes, int i, int tileId, bool flipH, bool flipV,
+                          float tEnter, float tExit, RaycastHit* outHit) {
+    if (tileId <= 0 || tileId >= TILESET_TILE_COUNT) return false;
+
+    uint8_t flags = g_LevelCollision.tileFlags[tileId];
+    bool topSolid = (flags & g_LevelCollision.topSolidMask) != 0;
+    bool lrbSolid = (flags & g_LevelCollision.lrbSolidMask) != 0;
+    if (!topSolid && !lrbSolid) return false;
+
+    float ox = lanes->originX[i], oy = lanes->originY[i];
+    float dx = lanes->dirX[i], dy = lanes->dirY[i];
+    int cellX = lanes->cellX[i], cellY = lanes->cellY[i];
+    float cellLeft = (float)(cellX * TILE_SIZE);
+    float cellTop = (float)(cellY * TILE_SIZE);
+
+    int firstColumn = (int)floorf(ox + dx * tEnter - cellLeft);
+    int lastColumn = (int)floorf(ox + dx * tExit - cellLeft);
+    if (firstColumn < 0) firstColumn = 0;
+    if (firstColumn >= TILE_SIZE) firstColumn = TILE_SIZE - 1;
+    if (lastColumn < 0) lastColumn = 0;
+    if (lastColumn >= TILE_SIZE) lastColumn = TILE_SIZE - 1;
+    int step = lastColumn >= firstColumn ? 1 : -1;
+
+    for (int column = firstColumn; ; column += step) {
+        // Part of the ray inside this column
+        float t0 = tEnter, t1 = tExit;
+        if (dx != 0) {
+            float tLeft = (cellLeft + (float)column - ox) / dx;
+            float tRight = (cellLeft + (float)(column + 1) - ox) / dx;
+            t0 = fmaxf(t0, fminf(tLeft, tRight));
+            t1 = fminf(t1, fmaxf(tLeft, tRight));
+        }
+
+        int height = TILESET_HEIGHTMAPS[tileId][flipH ? (TILE_SIZE - 1 - column) : column];
+        if (t0 <= t1 && height > 0) {
+            // Solid span of the column, from the bottom (or the top when flipped)
+            float top = flipV ? cellTop : cellTop + (float)(TILE_SIZE - height);
+            float bottom = flipV ? cellTop + (float)height : cellTop + (float)TILE_SIZE;
+
+            float s0 = -INFINITY, s1 = INFINITY;
+            bool inside = true;
+            if (dy != 0) {
+                float tTop = (top - oy) / dy, tBottom = (bottom - oy) / dy;
+                s0 = fminf(tTop, tBottom);
+                s1 = fmaxf(tTop, tBottom);
+            } else {
+                inside = oy >= top && oy <= bottom;
+            }
+
+            float hitT = fmaxf(t0, s0);
+            if (inside && hitT <= fminf(t1, s1)) {
+                // Entered through the span's top or bottom, or through its side
+                bool throughEnd = s0 >= t0;
+                bool fromAbove = throughEnd && dy > 0;
+                if (fromAbove ? topSolid : lrbSolid) {
+                    outHit->hit = true;
+                    outHit->distance = hitT;
+                    outHit->point = (Vector2){ox + dx * hitT, oy + dy * hitT};
+                    outHit->angle = throughEnd ? GetTileAngle(tileId) : (uint8_t)TILESET_WIDTH_ANGLES[tileId];
+                    outHit->tileX = cellX;
+                    outHit->tileY = cellY;
+                    outHit->tileId = tileId;
+                    return true;
+                }
+            }
+        }
+
+        if (column == lastColumn) break;
+    }
+    return false;
+}
+
+// Test the lane's current cell, skipping empty occupancy blocks first.
+// Returns true once the lane is finished (hit, or left the level / range).
+static bool VisitLane(RayLanes* lanes, int i, RaycastHit* outHit) {
+    uint8_t pathBit = (uint8_t)(1 << g_LevelCollision.path);
+    float ox = lanes->originX[i], oy = lanes->originY[i];
+    float dx = lanes->dirX[i], dy = lanes->dirY[i];
+
+    for (;;) {
+        int cellX = lanes->cellX[i], cellY = lanes->cellY[i];
+        if (lanes->t[i] > lanes->maxT[i] ||
+            cellX < 0 || cellX >= g_LevelCollision.width ||
+            cellY < 0 || cellY >= g_LevelCollision.height) {
+            return true;
+        }
+
+        int blockX = cellX >> COLLISION_BLOCK_SHIFT;
+        int blockY = cellY >> COLLISION_BLOCK_SHIFT;
+        if (g_LevelCollision.occupancy[(size_t)blockY * (size_t)g_LevelCollision.blocksWide + (size_t)blockX] & pathBit) {
+            break;
+        }
+
+        // Empty block: jump straight to where the ray leaves it
+        float blockLeft = (float)((blockX << COLLISION_BLOCK_SHIFT) * TILE_SIZE);
+        float blockTop = (float)((blockY << COLLISION_BLOCK_SHIFT) * TILE_SIZE);
+        float blockSize = (float)(COLLISION_BLOCK_TILES * TILE_SIZE);
+        float exitX = dx > 0 ? (blockLeft + blockSize - ox) / dx : dx < 0 ? (blockLeft - ox) / dx : INFINITY;
+        float exitY = dy > 0 ? (blockTop + blockSize - oy) / dy : dy < 0 ? (blockTop - oy) / dy : INFINITY;
+
+        // Pick the next cell explicitly so rounding can never leave the lane in place
+        int firstX = blockX << COLLISION_BLOCK_SHIFT, lastX = firstX + COLLISION_BLOCK_TILES - 1;
+        int firstY = blockY << COLLISION_BLOCK_SHIFT, lastY = firstY + COLLISION_BLOCK_TILES - 1;
+        float exitT;
+        if (exitX <= exitY) {
+            exitT = exitX;
+            cellX = dx > 0 ? lastX + 1 : firstX - 1;
+            cellY = (int)floorf((oy + dy * exitT) / TILE_SIZE);
+            if (cellY < firstY) cellY = firstY;
+            if (cellY > lastY) cellY = lastY;
+        } else {
+            exitT = exitY;
+            cellY = dy > 0 ? lastY + 1 : firstY - 1;
+            cellX = (int)floorf((ox + dx * exitT) / TILE_SIZE);
+            if (cellX < firstX) cellX = firstX;
+            if (cellX > lastX) cellX = lastX;
+        }
+        SeedLaneCell(lanes, i, exitT, cellX, cellY);
+    }
+
+    bool flipH, flipV;
+    int tileId = GetTileAtPosition(lanes->cellX[i] * TILE_SIZE, lanes->cellY[i] * TILE_SIZE, &flipH, &flipV);
+    if (tileId <= 0) return false;
+
+    float tExit = fminf(fminf(lanes->tMaxX[i], lanes->tMaxY[i]), lanes->maxT[i]);
+    return IntersectTile(lanes, i, tileId, flipH, flipV, lanes->t[i], tExit, outHit);
+}
+
+// Move every lane across the nearer grid line into its next cell
+static void StepLanes(RayLanes* lanes) {
+#if defined(PRESTO_RAYCAST_SSE)
+    __m128 tMaxX = _mm_load_ps(lanes->tMaxX);
+    __m128 tMaxY = _mm_load_ps(lanes->tMaxY);
+    __m128 alongX = _mm_cmplt_ps(tMaxX, tMaxY);
+    __m128i maskX = _mm_castps_si128(alongX);
+
+    _mm_store_ps(lanes->t, _mm_or_ps(_mm_and_ps(alongX, tMaxX), _mm_andnot_ps(alongX, tMaxY)));
+    _mm_store_ps(lanes->tMaxX, _mm_add_ps(tMaxX, _mm_and_ps(alongX, _mm_load_ps(lanes->tDeltaX))));
+    _mm_store_ps(lanes->tMaxY, _mm_add_ps(tMaxY, _mm_andnot_ps(alongX, _mm_load_ps(lanes->tDeltaY))));
+    _mm_store_si128((__m128i*)lanes->cellX, _mm_add_epi32(_mm_load_si128((const __m128i*)lanes->cellX),
+                    _mm_and_si128(maskX, _mm_load_si128((const __m128i*)lanes->stepX))));
+    _mm_store_si128((__m128i*)lanes->cellY, _mm_add_epi32(_mm_load_si128((const __m128i*)lanes->cellY),
+                    _mm_andnot_si128(maskX, _mm_load_si128((const __m128i*)lanes->stepY))));
+#elif defined(PRESTO_RAYCAST_NEON)
+    float32x4_t tMaxX = vld1q_f32(lanes->tMaxX);
+    float32x4_t tMaxY = vld1q_f32(lanes->tMaxY);
+    uint32x4_t alongX = vcltq_f32(tMaxX, tMaxY);
+    int32x4_t maskX = vreinterpretq_s32_u32(alongX);
+
+    vst1q_f32(lanes->t, vbslq_f32(alongX, tMaxX, tMaxY));
+    vst1q_f32(lanes->tMaxX, vaddq_f32(tMaxX, vreinterpretq_f32_u32(
+              vandq_u32(alongX, vreinterpretq_u32_f32(vld1q_f32(lanes->tDeltaX))))));
+    vst1q_f32(lanes->tMaxY, vaddq_f32(tMaxY, vreinterpretq_f32_u32(
+              vbicq_u32(vreinterpretq_u32_f32(vld1q_f32(lanes->tDeltaY)), alongX))));
+    vst1q_s32(lanes->cellX, vaddq_s32(vld1q_s32(lanes->cellX), vandq_s32(maskX, vld1q_s32(lanes->stepX))));
+    vst1q_s32(lanes->cellY, vaddq_s32(vld1q_s32(lanes->cellY), vbicq_s32(vld1q_s32(lanes->stepY), maskX)));
+#else
+    for (int i = 0; i < RAY_LANES; i++) {
+        if (lanes->tMaxX[i] < lanes->tMaxY[i]) {
+            lanes->t[i] = lanes->tMaxX[i];
+            lanes->tMaxX[i] += lanes->tDeltaX[i];
+            lanes->cellX[i] += lanes->stepX[i];
+        } else {
+            lanes->t[i] = lanes->tMaxY[i];
+            lanes->tMaxY[i] += lanes->tDeltaY[i];
+            lanes->cellY[i] += lanes->stepY[i];
+        }
+    }
+#endif
+}
+
+int RaycastTilesBatch(const Vector2* origins, const Vector2* directions, int count,
+                      float maxDistance, RaycastHit* outHits) {
+    if (!origins || !directions || !outHits || count <= 0) return 0;
+
+    int hits = 0;
+    for (int base = 0; base < count; base += RAY_LANES) {
+        RayLanes lanes;
+        memset(&lanes, 0, sizeof(lanes)); // Idle lanes step by zero
+
+        int live = 0;
+        for (int i = 0; i < RAY_LANES && base + i < count; i++) {
+            memset(&outHits[base + i], 0, sizeof(RaycastHit));
+            if (StartLane(&lanes, i, origins[base + i], directions[base + i], maxDistance)) live++;
+        }
+
+        while (live > 0) {
+            for (int i = 0; i < RAY_LANES; i++) {
+                if (!lanes.active[i] || !VisitLane(&lanes, i, &outHits[base + i])) continue;
+                lanes.active[i] = false;
+                live--;
+                if (outHits[base + i].hit) hits++;
+            }
+            if (live > 0) StepLanes(&lanes);
+        }
+    }
+    return hits;
+}
+
+bool RaycastTiles(Vector2 origin, Vector2 direction, float maxDistance, RaycastHit* outHit) {
+    RaycastHit hit;
+    RaycastTilesBatch(&origin, &direction, 1, maxDistance, &hit);
+    if (outHit) *outHit = hit;
+    return hit.hit;
+}
@@ -0,0 +1,31 @@
+// Raycast header - first solid tile surface along a ray, for camera
+// look-ahead, line of sight checks and debug overlays
+#ifndef PLAYER_RAYCAST_H
+#define PLAYER_RAYCAST_H
+
+#include "raylib.h"
+#include "player-collision.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    bool hit;
+    Vector2 point;        // Where the ray meets the surface
+    float distance;       // Pixels from the origin along the ray
+    uint8_t angle;        // Surface angle, same tables as the sensors
+    int tileX;            // Tile coordinates
+    int tileY;
+    int tileId;
+} RaycastHit;
+
+// Walk the tile grid of the active collision path (DDA), skipping empty
+// occupancy blocks, and intersect each solid tile's heightmap profile.
+// `direction` need not be normalized. Top-only tiles are only hit from above.
+bool RaycastTiles(Vector2 origin, Vector2 direction, float maxDistance, RaycastHit* outHit);
+
+// Same query for many rays. Rays run in groups of four lanes that step
+// through the grid together; returns how many rays hit.
+int RaycastTilesBatch(const Vector2* origins, const Vector2* directions, int count,
+                      float maxDistance, RaycastHit* outHits);
+
+#endif // PLAYER_RAYCAST_H
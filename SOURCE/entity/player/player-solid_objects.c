@@ -0,0 +1,210 @@
+// Solid objects implementation
+#include "player-solid_objects.h"
+#include "../../util/util-global.h"
+#include <math.h>
+#include <string.h>
+#include <stdio.h>
+
+#define SOLID_INDEX_NONE 0xFFFF
+
+void InitSolidObjects(SolidObjects* solids) {
+    if (!solids) return;
+    memset(solids, 0, sizeof(SolidObjects));
+    for (int i = 0; i <= SOLID_OBJECT_MAX; i++) solids->indexOf[i] = SOLID_INDEX_NONE;
+    InitSpatialHash(&solids->grid, SPATIAL_HASH_DEFAULT_CELL_TILES);
+}
+
+void FreeSolidObjects(SolidObjects* solids) {
+    if (!solids) return;
+    FreeSpatialHash(&solids->grid);
+    solids->count = 0;
+    for (int i = 0; i <= SOLID_OBJECT_MAX; i++) solids->indexOf[i] = SOLID_INDEX_NONE;
+}
+
+static int ResolveSolid(const SolidObjects* solids, int id) {
+    if (!solids || id <= 0 || id > SOLID_OBJECT_MAX) return -1;
+    int index = solids->indexOf[id];
+    return index == SOLID_INDEX_NONE ? -1 : index;
+}
+
+int AddSolidObject(SolidObjects* solids, Rectangle box, SolidType type, const uint8_t* heightmap) {
+    if (!solids) return 0;
+    if (solids->count >= SOLID_OBJECT_MAX) {
+        printf("Error: Maximum solid object limit reached.\n");
+        return 0;
+    }
+    if (type == SOLID_SLOPED && !heightmap) type = SOLID_FULL;
+
+    int id = 1;
+    while (solids->indexOf[id] != SOLID_INDEX_NONE) id++; // count < MAX, so a free id exists
+
+    int i = solids->count++;
+    solids->left[i] = box.x;
+    solids->top[i] = box.y;
+    solids->right[i] = box.x + box.width;
+    solids->bottom[i] = box.y + box.height;
+    solids->dx[i] = solids->dy[i] = 0.0f;
+    solids->pendingDx[i] = solids->pendingDy[i] = 0.0f;
+    solids->type[i] = (uint8_t)type;
+    solids->heightmap[i] = type == SOLID_SLOPED ? heightmap : NULL;
+    solids->id[i] = (uint16_t)id;
+    solids->indexOf[id] = (uint16_t)i;
+    return id;
+}
+
+void RemoveSolidObject(SolidObjects* solids, int id) {
+    int i = ResolveSolid(solids, id);
+    if (i < 0) return;
+
+    int last = --solids->count;
+    if (i != last) {
+        solids->left[i] = solids->left[last];
+        solids->top[i] = solids->top[last];
+        solids->right[i] = solids->right[last];
+        solids->bottom[i] = solids->bottom[last];
+        solids->dx[i] = solids->dx[last];
+        solids->dy[i] = solids->dy[last];
+        solids->pendingDx[i] = solids->pendingDx[last];
+        solids->pendingDy[i] = solids->pendingDy[last];
+        solids->type[i] = solids->type[last];
+        solids->heightmap[i] = solids->heightmap[last];
+        solids->id[i] = solids->id[last];
+        solids->indexOf[solids->id[i]] = (uint16_t)i;
+    }
+    solids->indexOf[id] = SOLID_INDEX_NONE;
+}
+
+void MoveSolidObject(SolidObjects* solids, int id, Vector2 delta) {
+    int i = ResolveSolid(solids, id);
+    if (i < 0) return;
+    solids->left[i] += delta.x;
+    solids->right[i] += delta.x;
+    solids->top[i] += delta.y;
+    solids->bottom[i] += delta.y;
+    solids->pendingDx[i] += delta.x;
+    solids->pendingDy[i] += delta.y;
+}
+
+Vector2 GetSolidObjectVelocity(const SolidObjects* solids, int id) {
+    int i = ResolveSolid(solids, id);
+    if (i < 0) return (Vector2){ 0.0f, 0.0f };
+    return (Vector2){ solids->dx[i], solids->dy[i] };
+}
+
+void RebuildSolidObjects(SolidObjects* solids) {
+    if (!solids) return;
+
+    Rectangle bounds[SOLID_OBJECT_MAX];
+    uint32_t ids[SOLID_OBJECT_MAX];
+    for (int i = 0; i < solids->count; i++) {
+        solids->dx[i] = solids->pendingDx[i];
+        solids->dy[i] = solids->pendingDy[i];
+        solids->pendingDx[i] = solids->pendingDy[i] = 0.0f;
+
+        bounds[i] = (Rectangle){ solids->left[i], solids->top[i],
+                                 solids->right[i] - solids->left[i], solids->bottom[i] - solids->top[i] };
+        ids[i] = solids->id[i];
+    }
+    RebuildSpatialHashFromBoxes(&solids->grid, bounds, ids, solids->count);
+}
+
+// Top surface Y of object i at world column x, false if the column is empty
+static bool SurfaceTopAt(const SolidObjects* solids, int i, float x, float* outY, uint8_t* outAngle) {
+    if (solids->type[i] != SOLID_SLOPED) {
+        *outY = solids->top[i];
+        *outAngle = 0;
+        return true;
+    }
+
+    const uint8_t* heights = solids->heightmap[i];
+    int width = (int)(solids->right[i] - solids->left[i]);
+    int column = (int)(x - solids->left[i]);
+    if (column < 0) column = 0;
+    if (column >= width) column = width - 1;
+    if (heights[column] == 0) return false;
+    *outY = solids->bottom[i] - heights[column];
+
+    // Slope from the neighbouring columns, same angle space as the tiles
+    int before = column > 0 ? heights[column - 1] : heights[column];
+    int after = column < width - 1 ? heights[column + 1] : heights[column];
+    float radians = atan2f((float)(after - before), column > 0 && column < width - 1 ? 2.0f : 1.0f);
+    *outAngle = (uint8_t)(int)lroundf(radians / (2.0f * PI) * 256.0f);
+    return true;
+}
+
+bool CheckSolidObjectSensor(SolidObjects* solids, Vector2 sensorPos, CollisionMode mode, SensorResult* out) {
+    if (!solids || !out || solids->count == 0) return false;
+
+    // Segment the sensor can see, from half a tile behind it to its reach
+    Rectangle probe;
+    switch (mode) {
+        case MODE_FLOOR:      probe = (Rectangle){ sensorPos.x, sensorPos.y - TILE_SIZE, 1, TILE_SIZE + SOLID_SENSOR_REACH }; break;
+        case MODE_CEILING:    probe = (Rectangle){ sensorPos.x, sensorPos.y - SOLID_SENSOR_REACH, 1, TILE_SIZE + SOLID_SENSOR_REACH }; break;
+        case MODE_RIGHT_WALL: probe = (Rectangle){ sensorPos.x - TILE_SIZE, sensorPos.y, TILE_SIZE + SOLID_SENSOR_REACH, 1 }; break;
+        case MODE_LEFT_WALL:  probe = (Rectangle){ sensorPos.x - SOLID_SENSOR_REACH, sensorPos.y, TILE_SIZE + SOLID_SENSOR_REACH, 1 }; break;
+        default: return false;
+    }
+
+    EntityHandle candidates[32];
+    int candidateCount = QuerySpatialRect(&solids->grid, probe, candidates, 32);
+
+    bool found = false;
+    int bestDistance = 0;
+    for (int c = 0; c < candidateCount; c++) {
+        int i = ResolveSolid(solids, (int)candidates[c]);
+        if (i < 0) continue;
+        if (solids->type[i] == SOLID_TOP_ONLY && mode != MODE_FLOOR) continue;
+
+        float surface = 0.0f;
+        uint8_t angle = 0;
+        int distance;
+        switch (mode) {
+            case MODE_FLOOR:
+                if (!SurfaceTopAt(solids, i, sensorPos.x, &surface, &angle)) continue;
+                distance = (int)floorf(surface) - (int)sensorPos.y;
+                break;
+            case MODE_CEILING:
+                surface = solids->bottom[i];
+                angle = 128;
+                distance = (int)sensorPos.y - (int)ceilf(surface);
+                break;
+            case MODE_RIGHT_WALL: {
+                float top;
+                uint8_t slope;
+                if (!SurfaceTopAt(solids, i, solids->left[i], &top, &slope) || sensorPos.y < top) continue;
+                surface = solids->left[i];
+                angle = 64;
+                distance = (int)floorf(surface) - (int)sensorPos.x;
+                break;
+            }
+            case MODE_LEFT_WALL: {
+                float top;
+                uint8_t slope;
+                if (!SurfaceTopAt(solids, i, solids->right[i] - 1, &top, &slope) || sensorPos.y < top) continue;
+                surface = solids->right[i];
+                angle = 192;
+                distance = (int)sensorPos.x - (int)ceilf(surface);
+                break;
+            }
+            default:
+                continue;
+        }
+
+        if (distance < -TILE_SIZE || distance > SOLID_SENSOR_REACH) continue;
+        if (found && distance >= bestDistance) continue;
+
+        found = true;
+        bestDistance = distance;
+        *out = (SensorResult){0};
+        out->found = true;
+        out->distance = distance;
+        out->angle = angle;
+        out->tileX = -1;
+        out->tileY = -1;
+        out->solidId = solids->id[i];
+        out->surfacePoint = (mode == MODE_FLOOR || mode == MODE_CEILING)
+            ? (Vector2){ sensorPos.x, surface }
+            : (Vector2){ surface, sensorPos.y };
+    }
+    return found;
+}
@@ -0,0 +1,59 @@
+// Solid objects header - platforms, monitors, springs and anything else the
+// player can stand on or push against besides the tile grid
+#ifndef PLAYER_SOLID_OBJECTS_H
+#define PLAYER_SOLID_OBJECTS_H
+
+#include "raylib.h"
+#include "player-collision.h"
+#include "../../managers/managers-spatial_hash.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SOLID_OBJECT_MAX 256
+#define SOLID_SENSOR_REACH 32   // How far past its position a sensor reports a surface
+
+typedef enum {
+    SOLID_FULL,       // Solid from every side
+    SOLID_TOP_ONLY,   // Only landed on from above (thin platforms)
+    SOLID_SLOPED      // Top follows a heightmap, flat sides and bottom
+} SolidType;
+
+// Solid shapes in SoA form, [0, count) are live. Objects move themselves
+// through MoveSolidObject during their update; RebuildSolidObjects then turns
+// the accumulated movement into this frame's carry velocity and re-bins every
+// box into a spatial hash, so a sensor only tests the few shapes around it.
+typedef struct SolidObjects {
+    float left[SOLID_OBJECT_MAX];
+    float top[SOLID_OBJECT_MAX];
+    float right[SOLID_OBJECT_MAX];
+    float bottom[SOLID_OBJECT_MAX];
+    float dx[SOLID_OBJECT_MAX];           // Movement during the last frame (carry velocity)
+    float dy[SOLID_OBJECT_MAX];
+    float pendingDx[SOLID_OBJECT_MAX];    // Movement since the last rebuild
+    float pendingDy[SOLID_OBJECT_MAX];
+    uint8_t type[SOLID_OBJECT_MAX];
+    const uint8_t* heightmap[SOLID_OBJECT_MAX]; // SOLID_SLOPED: height per pixel column, from the bottom
+    uint16_t id[SOLID_OBJECT_MAX];
+    uint16_t indexOf[SOLID_OBJECT_MAX + 1]; // id -> dense index, ids start at 1
+    int count;
+
+    SpatialHash grid;
+} SolidObjects;
+
+void InitSolidObjects(SolidObjects* solids);
+void FreeSolidObjects(SolidObjects* solids);
+
+// Returns the new object's id (0 when full). `heightmap` must stay valid and
+// hold one entry per pixel of the box width.
+int AddSolidObject(SolidObjects* solids, Rectangle box, SolidType type, const uint8_t* heightmap);
+void RemoveSolidObject(SolidObjects* solids, int id);
+void MoveSolidObject(SolidObjects* solids, int id, Vector2 delta);
+Vector2 GetSolidObjectVelocity(const SolidObjects* solids, int id);
+
+// Once per frame, after objects moved and before the player collides
+void RebuildSolidObjects(SolidObjects* solids);
+
+// Closest solid surface for a sensor, same distance conventions as the tile sensors
+bool CheckSolidObjectSensor(SolidObjects* solids, Vector2 sensorPos, CollisionMode mode, SensorResult* out);
+
+#endif // PLAYER_SOLID_OBJECTS_H
@@ -28,6 +28,8 @@
 #include <string.h>
 #include <stdint.h>
 
+static AudioManager audioManager;
+
 int main(void) {
     // Initialize Raylib window first
     InitWindow(VIRTUAL_SCREEN_WIDTH, VIRTUAL_SCREEN_HEIGHT, GAME_TITLE " - " GAME_VERSION);
@@ -49,6 +51,13 @@ int main(void) {
     InitScreenSettings();
     PrestoSetWindowSize(g_Options.screenSize);
     
+    // Initialize the shared texture/sound cache
+    InitResourceManager();
+
+    // Sound effects and music, shared through gAudioManager
+    InitAudioManager(&audioManager);
+    gAudioManager = &audioManager;
+
     // Initialize sprite fonts
     InitSpriteFontManager();
 
@@ -66,6 +75,13 @@ int main(void) {
 
     while (!WindowShouldClose()) {
         UpdateScreenManager(&g_ScreenManager, GetFrameTime());
+
+        // Release finished sound effects, then unload resources whose grace period expired
+        UpdateAudioManager(gAudioManager, GetFrameTime());
+        UpdateResourceManager(GetFrameTime());
+
+        // Advance palette cycles and upload changed palettes
+        UpdatePalettes(GetFrameTime());
         
         // Update unified input system
         UpdateUnifiedInput(GetFrameTime());
@@ -107,6 +123,11 @@ int main(void) {
     UnloadScreenManager(&g_ScreenManager);
     UnloadScreenSettings();
     CleanupSpriteFontManager();
+    UnloadMenuBackgrounds();
+    UnloadPalettes();
+    UnloadAllAudio(gAudioManager);
+    gAudioManager = NULL;
+    UnloadResourceManager();
     CloseAudioDevice();
     CloseWindow();
 
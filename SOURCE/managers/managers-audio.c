@@ -1,5 +1,8 @@
 // Audio Manager 
 #include "managers-audio.h"
+#include "managers-resource.h"
+
+AudioManager* gAudioManager = NULL;
 
 void InitAudioManager(AudioManager* manager) {
     if (manager == NULL) return;
@@ -8,6 +11,7 @@ void InitAudioManager(AudioManager* manager) {
     manager->music_count = 0;
     manager->vox_count = 0;
     manager->ambience_count = 0;
+    manager->playingSfxCount = 0;
 
     manager->masterVolume = 1.0f;
     manager->musicVolume = 1.0f;
@@ -33,9 +37,27 @@ void InitAudioManager(AudioManager* manager) {
     manager->isPendingMusicDelayed = false;
 }
 
+// Drops the cache reference of a tracked effect; it must no longer be playing.
+// Keeps the table in start order so slot 0 is always the oldest effect.
+static void ReleasePlayingSFX(AudioManager* manager, size_t index) {
+    UnloadCachedSound(manager->playingSfx[index]);
+    manager->playingSfxCount--;
+    memmove(&manager->playingSfx[index], &manager->playingSfx[index + 1],
+            (manager->playingSfxCount - index) * sizeof(Sound));
+}
+
 void UpdateAudioManager(AudioManager* manager, float deltaTime) {
     if (manager == NULL) return;
 
+    // Release effects that finished playing
+    for (size_t i = 0; i < manager->playingSfxCount; ) {
+        if (IsSoundPlaying(manager->playingSfx[i])) {
+            i++;
+        } else {
+            ReleasePlayingSFX(manager, i);
+        }
+    }
+
     // Update music fading
     if (manager->isFadingOut) {
         manager->fadeOutTimer += deltaTime;
@@ -75,7 +97,19 @@ void UpdateAudioManager(AudioManager* manager, float deltaTime) {
 bool PlaySFX(AudioManager* manager, const char* path, float volume) {
     if (manager == NULL || !manager->isSfxEnabled) return false;
 
-    Sound sound = LoadSound(path);
+    Sound sound = LoadCachedSound(path);
+    if (sound.frameCount == 0) return false;
+
+    // Keep the reference while the effect plays; UpdateAudioManager releases it
+    // once playback ends, so neither the cache grace period nor an uncached
+    // unload can pull the sound out from under the mixer. When every slot is
+    // taken the oldest effect is cut off to make room.
+    if (manager->playingSfxCount == MAX_PLAYING_SFX) {
+        StopSound(manager->playingSfx[0]);
+        ReleasePlayingSFX(manager, 0);
+    }
+    manager->playingSfx[manager->playingSfxCount++] = sound;
+
     PrestoSetSFXVolume(manager, volume * manager->sfxVolume * manager->masterVolume);
     PlaySound(sound);
 
@@ -206,6 +240,12 @@ void UnloadAllAudio(AudioManager* manager) {
         StopMusic(manager);
     }
 
+    // Stop tracked effects before their references go
+    while (manager->playingSfxCount > 0) {
+        StopSound(manager->playingSfx[0]);
+        ReleasePlayingSFX(manager, 0);
+    }
+
     // Unload sounds
     for (size_t i = 0; i < manager->sound_count; i++) {
         UnloadSound(manager->sounds[i].sound);
@@ -15,6 +15,7 @@
 
 #define MAX_SOUNDS 100
 #define MAX_MUSIC_TRACKS 24
+#define MAX_PLAYING_SFX 16
 
 typedef enum {
     MUSIC,
@@ -40,6 +41,10 @@ typedef struct {
     size_t vox_count;
     size_t ambience_count;
 
+    // Effects still playing; each keeps its cache reference until playback ends
+    Sound playingSfx[MAX_PLAYING_SFX];
+    size_t playingSfxCount;
+
     float masterVolume;
     float musicVolume;
     float sfxVolume;
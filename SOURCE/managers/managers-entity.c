@@ -2,68 +2,261 @@
 #include "managers-entity.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+EntityManager* gEntityManager = NULL;
+
+static const size_t componentSizes[COMPONENT_COUNT] = {
+    [COMPONENT_TRANSFORM] = sizeof(TransformComponent),
+    [COMPONENT_VELOCITY]  = sizeof(VelocityComponent),
+    [COMPONENT_SHAPE]     = sizeof(ShapeComponent),
+    [COMPONENT_NAME]      = sizeof(NameComponent),
+    [COMPONENT_COLLIDER]  = sizeof(ColliderComponent),
+};
+
+static inline int HandleSlot(EntityHandle handle) {
+    return (int)(handle & ENTITY_HANDLE_INDEX_MASK);
+}
+
+static inline uint16_t HandleGeneration(EntityHandle handle) {
+    return (uint16_t)(handle >> ENTITY_HANDLE_INDEX_BITS);
+}
+
+// Dense index of a live handle, -1 if the handle is stale or out of range
+static int ResolveHandle(const EntityManager* manager, EntityHandle handle) {
+    int slot = HandleSlot(handle);
+    if (slot >= MAX_ENTITIES) return -1;
+    if (manager->generations[slot] != HandleGeneration(handle)) return -1;
+
+    int dense = manager->slotToDense[slot];
+    if (dense >= manager->entityCount || manager->denseToSlot[dense] != slot) return -1;
+    return dense;
+}
+
+static unsigned char* ComponentArray(EntityManager* manager, ComponentType type) {
+    switch (type) {
+        case COMPONENT_TRANSFORM: return (unsigned char*)manager->transforms;
+        case COMPONENT_VELOCITY:  return (unsigned char*)manager->velocities;
+        case COMPONENT_SHAPE:     return (unsigned char*)manager->shapes;
+        case COMPONENT_NAME:      return (unsigned char*)manager->names;
+        case COMPONENT_COLLIDER:  return (unsigned char*)manager->colliders;
+        default:                  return NULL;
+    }
+}
+
+// Swap-removes the component of `slot` from its dense array
+static void EraseComponent(EntityManager* manager, int slot, ComponentType type) {
+    ComponentIndex* index = &manager->componentIndex[type];
+    int dense = index->sparse[slot];
+    int last = --index->count;
+
+    if (dense != last) {
+        unsigned char* data = ComponentArray(manager, type);
+        size_t size = componentSizes[type];
+        int movedSlot = index->denseSlot[last];
+        memcpy(data + (size_t)dense * size, data + (size_t)last * size, size);
+        index->denseSlot[dense] = (uint16_t)movedSlot;
+        index->sparse[movedSlot] = (uint16_t)dense;
+    }
+    index->sparse[slot] = COMPONENT_NONE;
+}
 
 void InitEntityManager(EntityManager* manager) {
     if (manager == NULL) return;
     manager->entityCount = 0;
     for (int i = 0; i < MAX_ENTITIES; i++) {
-        manager->entities[i] = NULL;
+        manager->generations[i] = 1; // Generation 0 is reserved so handle 0 stays invalid
+        manager->nextFree[i] = (uint16_t)(i + 1);
+        manager->slotToDense[i] = 0;
+        manager->denseToSlot[i] = 0;
+    }
+    manager->freeHead = 0;
+
+    for (int type = 0; type < COMPONENT_COUNT; type++) {
+        ComponentIndex* index = &manager->componentIndex[type];
+        for (int i = 0; i < MAX_ENTITIES; i++) index->sparse[i] = COMPONENT_NONE;
+        index->count = 0;
     }
 }
 
-void AddEntity(EntityManager* manager, Entity* entity) {
-    if (manager == NULL || entity == NULL) return;
-    if (manager->entityCount >= MAX_ENTITIES) {
+EntityHandle AddEntity(EntityManager* manager) {
+    if (manager == NULL) return ENTITY_HANDLE_NULL;
+    if (manager->freeHead < 0 || manager->freeHead >= MAX_ENTITIES) {
         printf("Error: Maximum entity limit reached.\n");
-        return;
+        return ENTITY_HANDLE_NULL;
     }
-    manager->entities[manager->entityCount++] = entity;
+
+    int slot = manager->freeHead;
+    manager->freeHead = manager->nextFree[slot] < MAX_ENTITIES ? manager->nextFree[slot] : -1;
+
+    int dense = manager->entityCount++;
+    manager->slotToDense[slot] = (uint16_t)dense;
+    manager->denseToSlot[dense] = (uint16_t)slot;
+
+    EntityHandle handle = ((EntityHandle)manager->generations[slot] << ENTITY_HANDLE_INDEX_BITS) | (EntityHandle)slot;
+    manager->entities[dense] = (Entity){ .id = handle, .components = 0, .placement = -1, .active = true };
+    return handle;
 }
 
-void RemoveEntity(EntityManager* manager, int entityId) {
-    if (manager == NULL) return;
-    for (int i = 0; i < manager->entityCount; i++) {
-        if (manager->entities[i] != NULL && manager->entities[i]->id == entityId) {
-            free(manager->entities[i]);
-            manager->entities[i] = NULL;
-            // Shift remaining entities
-            for (int j = i; j < manager->entityCount - 1; j++) {
-                manager->entities[j] = manager->entities[j + 1];
-            }
-            manager->entities[--manager->entityCount] = NULL;
-            return;
-        }
+bool RemoveEntity(EntityManager* manager, EntityHandle handle) {
+    if (manager == NULL) return false;
+    int dense = ResolveHandle(manager, handle);
+    if (dense < 0) {
+        printf("Warning: Entity handle 0x%08X is not alive.\n", (unsigned)handle);
+        return false;
+    }
+
+    int slot = HandleSlot(handle);
+    uint32_t components = manager->entities[dense].components;
+    for (int type = 0; type < COMPONENT_COUNT; type++) {
+        if (components & COMPONENT_BIT(type)) EraseComponent(manager, slot, (ComponentType)type);
+    }
+
+    // Swap the last entity into the hole
+    int last = --manager->entityCount;
+    if (dense != last) {
+        int movedSlot = manager->denseToSlot[last];
+        manager->entities[dense] = manager->entities[last];
+        manager->denseToSlot[dense] = (uint16_t)movedSlot;
+        manager->slotToDense[movedSlot] = (uint16_t)dense;
     }
-    printf("Warning: Entity with ID %d not found.\n", entityId);
+
+    // Retire the slot: bump its generation (skipping 0) and push it on the free list
+    uint16_t generation = (uint16_t)(manager->generations[slot] + 1);
+    manager->generations[slot] = generation ? generation : 1;
+    manager->nextFree[slot] = (uint16_t)(manager->freeHead < 0 ? MAX_ENTITIES : manager->freeHead);
+    manager->freeHead = slot;
+    return true;
 }
 
-void UpdateEntities(EntityManager* manager, float deltaTime) {
-    if (manager == NULL) return;
-    for (int i = 0; i < manager->entityCount; i++) {
-        Entity* entity = manager->entities[i];
-        if (entity != NULL && entity->active) {
-            entity->position.x += entity->velocity.x * deltaTime;
-            entity->position.y += entity->velocity.y * deltaTime;
-        }
+// The pointer is only valid until the next AddEntity/RemoveEntity, keep the handle instead
+Entity* GetEntityById(EntityManager* manager, EntityHandle handle) {
+    if (manager == NULL) return NULL;
+    int dense = ResolveHandle(manager, handle);
+    return dense < 0 ? NULL : &manager->entities[dense];
+}
+
+bool IsEntityValid(const EntityManager* manager, EntityHandle handle) {
+    return manager != NULL && ResolveHandle(manager, handle) >= 0;
+}
+
+// ===== Components =====
+
+// Adds a zeroed component (or returns the existing one)
+void* AddComponent(EntityManager* manager, EntityHandle handle, ComponentType type) {
+    if (manager == NULL || type < 0 || type >= COMPONENT_COUNT) return NULL;
+    int dense = ResolveHandle(manager, handle);
+    if (dense < 0) return NULL;
+
+    int slot = HandleSlot(handle);
+    ComponentIndex* index = &manager->componentIndex[type];
+    unsigned char* data = ComponentArray(manager, type);
+    size_t size = componentSizes[type];
+
+    if (index->sparse[slot] != COMPONENT_NONE) {
+        return data + (size_t)index->sparse[slot] * size;
     }
+
+    int component = index->count++;
+    index->sparse[slot] = (uint16_t)component;
+    index->denseSlot[component] = (uint16_t)slot;
+    manager->entities[dense].components |= COMPONENT_BIT(type);
+
+    unsigned char* out = data + (size_t)component * size;
+    memset(out, 0, size);
+    return out;
 }
 
-void DrawEntities(const EntityManager* manager) {
+bool RemoveComponent(EntityManager* manager, EntityHandle handle, ComponentType type) {
+    if (manager == NULL || type < 0 || type >= COMPONENT_COUNT) return false;
+    int dense = ResolveHandle(manager, handle);
+    if (dense < 0 || !(manager->entities[dense].components & COMPONENT_BIT(type))) return false;
+
+    EraseComponent(manager, HandleSlot(handle), type);
+    manager->entities[dense].components &= ~COMPONENT_BIT(type);
+    return true;
+}
+
+void* GetComponent(EntityManager* manager, EntityHandle handle, ComponentType type) {
+    if (manager == NULL || type < 0 || type >= COMPONENT_COUNT) return NULL;
+    if (ResolveHandle(manager, handle) < 0) return NULL;
+
+    uint16_t component = manager->componentIndex[type].sparse[HandleSlot(handle)];
+    if (component == COMPONENT_NONE) return NULL;
+    return ComponentArray(manager, type) + (size_t)component * componentSizes[type];
+}
+
+bool HasComponents(const EntityManager* manager, EntityHandle handle, uint32_t mask) {
+    if (manager == NULL) return false;
+    int dense = ResolveHandle(manager, handle);
+    return dense >= 0 && (manager->entities[dense].components & mask) == mask;
+}
+
+// World-space AABB from the transform and collider components
+bool GetEntityBounds(const EntityManager* manager, EntityHandle handle, Rectangle* outBounds) {
+    if (manager == NULL || outBounds == NULL || ResolveHandle(manager, handle) < 0) return false;
+
+    int slot = HandleSlot(handle);
+    uint16_t transform = manager->componentIndex[COMPONENT_TRANSFORM].sparse[slot];
+    uint16_t collider = manager->componentIndex[COMPONENT_COLLIDER].sparse[slot];
+    if (transform == COMPONENT_NONE || collider == COMPONENT_NONE) return false;
+
+    Vector2 position = manager->transforms[transform].position;
+    const ColliderComponent* box = &manager->colliders[collider];
+    *outBounds = (Rectangle){
+        position.x + box->offset.x - box->halfSize.x,
+        position.y + box->offset.y - box->halfSize.y,
+        box->halfSize.x * 2.0f,
+        box->halfSize.y * 2.0f
+    };
+    return true;
+}
+
+// ===== Systems =====
+// Each system walks the dense array of its rarest component and reaches the
+// others through the sparse index of the same slot.
+
+static inline bool IsSlotActive(const EntityManager* manager, int slot) {
+    return manager->entities[manager->slotToDense[slot]].active;
+}
+
+void MovementSystem(EntityManager* manager, float deltaTime) {
     if (manager == NULL) return;
-    for (int i = 0; i < manager->entityCount; i++) {
-        Entity* entity = manager->entities[i];
-        if (entity != NULL && entity->active) {
-            DrawCircleV(entity->position, 10.0f, BLUE); // Simple representation
-        }
+    const ComponentIndex* velocityIndex = &manager->componentIndex[COMPONENT_VELOCITY];
+    const ComponentIndex* transformIndex = &manager->componentIndex[COMPONENT_TRANSFORM];
+
+    for (int i = 0; i < velocityIndex->count; i++) {
+        int slot = velocityIndex->denseSlot[i];
+        uint16_t transform = transformIndex->sparse[slot];
+        if (transform == COMPONENT_NONE || !IsSlotActive(manager, slot)) continue;
+
+        Vector2 velocity = manager->velocities[i].velocity;
+        manager->transforms[transform].position.x += velocity.x * deltaTime;
+        manager->transforms[transform].position.y += velocity.y * deltaTime;
     }
 }
 
-Entity* GetEntityById(const EntityManager* manager, int entityId) {
-    if (manager == NULL) return NULL;
-    for (int i = 0; i < manager->entityCount; i++) {
-        if (manager->entities[i] != NULL && manager->entities[i]->id == entityId) {
-            return manager->entities[i];
-        }
+void ShapeRenderSystem(const EntityManager* manager) {
+    if (manager == NULL) return;
+    const ComponentIndex* shapeIndex = &manager->componentIndex[COMPONENT_SHAPE];
+    const ComponentIndex* transformIndex = &manager->componentIndex[COMPONENT_TRANSFORM];
+
+    for (int i = 0; i < shapeIndex->count; i++) {
+        int slot = shapeIndex->denseSlot[i];
+        uint16_t transform = transformIndex->sparse[slot];
+        if (transform == COMPONENT_NONE || !IsSlotActive(manager, slot)) continue;
+
+        const ShapeComponent* shape = &manager->shapes[i];
+        DrawCircleV(manager->transforms[transform].position, shape->radius, shape->color);
     }
-    return NULL;
-}
\ No newline at end of file
+}
+
+// Runs the update systems in order
+void UpdateEntities(EntityManager* manager, float deltaTime) {
+    MovementSystem(manager, deltaTime);
+}
+
+// Runs the render systems in order
+void DrawEntities(const EntityManager* manager) {
+    ShapeRenderSystem(manager);
+}
@@ -4,30 +4,117 @@
 
 #include "raylib.h"
 #include <stdio.h>
+#include <stdint.h>
 
-#define MAX_ENTITIES 256
+#define MAX_ENTITIES 1024
+
+// 32-bit generational handle: slot index in the low 16 bits, the slot's
+// generation in the high 16 bits. A handle goes stale as soon as its entity is
+// removed, even if the slot is reused. 0 is never a valid handle.
+typedef uint32_t EntityHandle;
+
+#define ENTITY_HANDLE_NULL 0u
+#define ENTITY_HANDLE_INDEX_BITS 16
+#define ENTITY_HANDLE_INDEX_MASK 0xFFFFu
+
+// ===== Components =====
+// Each component type lives in its own dense array. Systems walk one of those
+// arrays and look up the others through the per-type sparse index, so an
+// entity only pays for the components it has.
+typedef enum {
+    COMPONENT_TRANSFORM,
+    COMPONENT_VELOCITY,
+    COMPONENT_SHAPE,
+    COMPONENT_NAME,
+    COMPONENT_COLLIDER,
+    COMPONENT_COUNT
+} ComponentType;
+
+#define COMPONENT_BIT(type) (1u << (type))
 
 typedef struct {
-    int id;
-    char name[64];
     Vector2 position;
-    Vector2 velocity;
     float rotation;
+} TransformComponent;
+
+typedef struct {
+    Vector2 velocity;
+} VelocityComponent;
+
+typedef struct {
+    float radius;
+    Color color;
+} ShapeComponent;
+
+typedef struct {
+    char name[64];
+} NameComponent;
+
+// Axis-aligned box around the transform position
+typedef struct {
+    Vector2 offset;
+    Vector2 halfSize;
+} ColliderComponent;
+
+#define COMPONENT_NONE 0xFFFFu
+
+// Sparse set for one component type: slot -> dense index and back
+typedef struct {
+    uint16_t sparse[MAX_ENTITIES];
+    uint16_t denseSlot[MAX_ENTITIES];
+    int count;
+} ComponentIndex;
+
+// ===== Entities =====
+typedef struct {
+    EntityHandle id;
+    uint32_t components; // COMPONENT_BIT mask
+    int placement;       // Index in the level's object layout, -1 if spawned at runtime
     bool active;
 } Entity;
 
+// Entities live in a contiguous pool, [0, entityCount) are alive. Removal
+// swaps the last entity into the hole (same for every component array), so
+// iteration order is not stable and loops that remove while iterating should
+// walk backwards. Handles map to dense positions through a slot table with a
+// free list, so add, remove and lookup are all O(1) and nothing is allocated
+// per entity.
 typedef struct {
-    Entity* entities[MAX_ENTITIES];
+    Entity entities[MAX_ENTITIES];
+    uint16_t denseToSlot[MAX_ENTITIES];
+    uint16_t slotToDense[MAX_ENTITIES];
+    uint16_t generations[MAX_ENTITIES];
+    uint16_t nextFree[MAX_ENTITIES];
+    int freeHead;   // First free slot, -1 when full
     int entityCount;
+
+    ComponentIndex componentIndex[COMPONENT_COUNT];
+    TransformComponent transforms[MAX_ENTITIES];
+    VelocityComponent velocities[MAX_ENTITIES];
+    ShapeComponent shapes[MAX_ENTITIES];
+    NameComponent names[MAX_ENTITIES];
+    ColliderComponent colliders[MAX_ENTITIES];
 } EntityManager;
 
 extern EntityManager* gEntityManager;
 
 void InitEntityManager(EntityManager* manager);
-void AddEntity(EntityManager* manager, Entity* entity);
-void RemoveEntity(EntityManager* manager, int entityId);
+EntityHandle AddEntity(EntityManager* manager);
+bool RemoveEntity(EntityManager* manager, EntityHandle handle);
+Entity* GetEntityById(EntityManager* manager, EntityHandle handle);
+bool IsEntityValid(const EntityManager* manager, EntityHandle handle);
+
+// Component access (returned pointers are invalidated by adding/removing that component type)
+void* AddComponent(EntityManager* manager, EntityHandle handle, ComponentType type);
+bool RemoveComponent(EntityManager* manager, EntityHandle handle, ComponentType type);
+void* GetComponent(EntityManager* manager, EntityHandle handle, ComponentType type);
+bool HasComponents(const EntityManager* manager, EntityHandle handle, uint32_t mask);
+bool GetEntityBounds(const EntityManager* manager, EntityHandle handle, Rectangle* outBounds);
+
+// Systems
+void MovementSystem(EntityManager* manager, float deltaTime);
+void ShapeRenderSystem(const EntityManager* manager);
 void UpdateEntities(EntityManager* manager, float deltaTime);
 void DrawEntities(const EntityManager* manager);
-Entity* GetEntityById(const EntityManager* manager, int entityId);
 
-#endif // MANAGERS_ENTITY_H
\ No newline at end of file
+#endif // MANAGERS_ENTITY_H
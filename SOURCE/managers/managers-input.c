@@ -5,6 +5,9 @@
 // Unified input state
 static UnifiedInputState unifiedInput = {0};
 
+// When set, the queries below read this frame instead of the live state
+static _Thread_local const InputFrame* inputOverride = NULL;
+
 void InitUnifiedInput(void) {
     memset(&unifiedInput, 0, sizeof(unifiedInput));
     unifiedInput.gamepadId = 0;
@@ -98,14 +101,17 @@ void UpdateUnifiedInput(float deltaTime) {
 }
 
 bool IsInputDown(InputBit bit) {
+    if (inputOverride) return (inputOverride->down & INPUT_MASK(bit)) != 0;
     return (unifiedInput.curState & INPUT_MASK(bit)) != 0;
 }
 
 bool IsInputPressed(InputBit bit) {
+    if (inputOverride) return (inputOverride->pressed & INPUT_MASK(bit)) != 0;
     return (unifiedInput.pressedMask & INPUT_MASK(bit)) != 0;
 }
 
 bool IsInputReleased(InputBit bit) {
+    if (inputOverride) return (inputOverride->released & INPUT_MASK(bit)) != 0;
     return (unifiedInput.releasedMask & INPUT_MASK(bit)) != 0;
 }
 
@@ -115,4 +121,55 @@ float GetInputHoldTime(InputBit bit) {
 
 void SetInputGamepadId(int id) {
     unifiedInput.gamepadId = id;
+}
+
+// ===== Input frames =====
+
+void CaptureInputFrame(InputFrame* frame) {
+    if (!frame) return;
+    memset(frame, 0, sizeof(InputFrame));
+
+    frame->down = unifiedInput.curState;
+    frame->pressed = unifiedInput.pressedMask;
+    frame->released = unifiedInput.releasedMask;
+    for (int key = 0; key < INPUT_KEY_COUNT; key++) {
+        if (IsKeyDown(key)) frame->keysDown[key >> 3] |= (uint8_t)(1u << (key & 7));
+        if (IsKeyPressed(key)) frame->keysPressed[key >> 3] |= (uint8_t)(1u << (key & 7));
+    }
+}
+
+void AccumulateInputFrame(InputFrame* pending, const InputFrame* latest) {
+    if (!pending || !latest) return;
+
+    pending->down = latest->down;
+    pending->pressed |= latest->pressed;
+    pending->released |= latest->released;
+    for (int i = 0; i < INPUT_KEY_COUNT / 8; i++) {
+        pending->keysDown[i] = latest->keysDown[i];
+        pending->keysPressed[i] |= latest->keysPressed[i];
+    }
+}
+
+void ClearInputFrameEdges(InputFrame* frame) {
+    if (!frame) return;
+
+    frame->pressed = 0;
+    frame->released = 0;
+    memset(frame->keysPressed, 0, sizeof(frame->keysPressed));
+}
+
+void SetInputFrameOverride(const InputFrame* frame) {
+    inputOverride = frame;
+}
+
+bool IsInputKeyDown(int key) {
+    if (!inputOverride) return IsKeyDown(key);
+    if (key < 0 || key >= INPUT_KEY_COUNT) return false;
+    return (inputOverride->keysDown[key >> 3] & (1u << (key & 7))) != 0;
+}
+
+bool IsInputKeyPressed(int key) {
+    if (!inputOverride) return IsKeyPressed(key);
+    if (key < 0 || key >= INPUT_KEY_COUNT) return false;
+    return (inputOverride->keysPressed[key >> 3] & (1u << (key & 7))) != 0;
 }
\ No newline at end of file
@@ -46,6 +46,21 @@ typedef struct {
     bool useGamepad;
 } UnifiedInputState;
 
+// Keyboard keys tracked by InputFrame (covers every raylib KeyboardKey)
+#define INPUT_KEY_COUNT 352
+
+// Copy of the input state handed to code running off the main thread, where
+// raylib's input functions must not be called. Pressed/released edges are
+// accumulated until the consumer takes the frame, so no press is lost when
+// the consumer ticks slower than the window polls.
+typedef struct {
+    InputMask down;
+    InputMask pressed;
+    InputMask released;
+    uint8_t keysDown[INPUT_KEY_COUNT / 8];
+    uint8_t keysPressed[INPUT_KEY_COUNT / 8];
+} InputFrame;
+
 // Global unified input functions
 void InitUnifiedInput(void);
 void UpdateUnifiedInput(float deltaTime);
@@ -55,4 +70,12 @@ bool IsInputReleased(InputBit bit);
 float GetInputHoldTime(InputBit bit);
 void SetInputGamepadId(int id);
 
+// Input frames (see InputFrame)
+void CaptureInputFrame(InputFrame* frame);
+void AccumulateInputFrame(InputFrame* pending, const InputFrame* latest);
+void ClearInputFrameEdges(InputFrame* frame);
+void SetInputFrameOverride(const InputFrame* frame); // Per thread, NULL reads live input
+bool IsInputKeyDown(int key);
+bool IsInputKeyPressed(int key);
+
 #endif // MANAGERS_INPUT_H
\ No newline at end of file
@@ -0,0 +1,183 @@
+// Object layout implementation
+// Camera-window object activation with persistent per-placement state
+#include "managers-object_layout.h"
+#include <string.h>
+#include "../data/data-csv_loader.h"
+
+static int ComparePlacements(const void* a, const void* b) {
+    const ObjectPlacement* pa = (const ObjectPlacement*)a;
+    const ObjectPlacement* pb = (const ObjectPlacement*)b;
+    if (pa->x != pb->x) return pa->x < pb->x ? -1 : 1;
+    if (pa->y != pb->y) return pa->y < pb->y ? -1 : 1;
+    return 0;
+}
+
+EntityHandle SpawnObjectMarker(EntityManager* manager, const ObjectPlacement* placement) {
+    static const Color typeColors[] = { RED, ORANGE, YELLOW, GREEN, SKYBLUE, PURPLE, PINK, WHITE };
+
+    EntityHandle handle = AddEntity(manager);
+    if (handle == ENTITY_HANDLE_NULL) return handle;
+
+    TransformComponent* transform = AddComponent(manager, handle, COMPONENT_TRANSFORM);
+    transform->position = (Vector2){ (float)placement->x, (float)placement->y };
+    ShapeComponent* shape = AddComponent(manager, handle, COMPONENT_SHAPE);
+    shape->radius = 6.0f;
+    shape->color = typeColors[(unsigned)placement->type % (sizeof(typeColors) / sizeof(typeColors[0]))];
+    ColliderComponent* collider = AddComponent(manager, handle, COMPONENT_COLLIDER);
+    collider->halfSize = (Vector2){ shape->radius, shape->radius };
+    return handle;
+}
+
+static void SpawnPlacement(ObjectLayout* layout, EntityManager* manager, int index) {
+    if (layout->state[index] & OBJECT_STATE_REMOVED) return;
+    if (IsEntityValid(manager, layout->spawned[index])) return;
+
+    ObjectSpawnFunc spawn = layout->spawn ? layout->spawn : SpawnObjectMarker;
+    EntityHandle handle = spawn(manager, &layout->placements[index]);
+    layout->spawned[index] = handle;
+
+    Entity* entity = GetEntityById(manager, handle);
+    if (entity) entity->placement = index;
+}
+
+static void DespawnPlacement(ObjectLayout* layout, EntityManager* manager, int index) {
+    // The object may already have removed itself (destroyed, collected)
+    if (IsEntityValid(manager, layout->spawned[index])) {
+        RemoveEntity(manager, layout->spawned[index]);
+    }
+    layout->spawned[index] = ENTITY_HANDLE_NULL;
+}
+
+// First placement with x >= value (strict: x > value)
+static int FindPlacement(const ObjectLayout* layout, float value, bool strict) {
+    int low = 0, high = layout->count;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        float x = (float)layout->placements[mid].x;
+        if (strict ? x <= value : x < value) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+bool LoadObjectLayout(ObjectLayout* layout, const char* filePath) {
+    if (!layout || !filePath) return false;
+    memset(layout, 0, sizeof(ObjectLayout));
+    layout->margin = OBJECT_LAYOUT_DEFAULT_MARGIN;
+
+    int columns = 0, rows = 0;
+    int** data = LoadCSVIntWithDimensions(filePath, &columns, &rows);
+    if (!data) return false;
+    if (columns < 4) {
+        printf("Error: Object layout %s needs type,x,y,subtype columns\n", filePath);
+        FreeCSVData(data, rows);
+        return false;
+    }
+
+    layout->placements = malloc(sizeof(ObjectPlacement) * (size_t)rows);
+    layout->spawned = calloc((size_t)rows, sizeof(EntityHandle));
+    layout->state = calloc((size_t)rows, sizeof(uint8_t));
+    if (!layout->placements || !layout->spawned || !layout->state) {
+        printf("Error: Failed to allocate object layout\n");
+        free(layout->placements);
+        free(layout->spawned);
+        free(layout->state);
+        FreeCSVData(data, rows);
+        memset(layout, 0, sizeof(ObjectLayout));
+        return false;
+    }
+
+    for (int i = 0; i < rows; i++) {
+        layout->placements[i] = (ObjectPlacement){ data[i][1], data[i][2], data[i][0], data[i][3] };
+    }
+    layout->count = rows;
+    FreeCSVData(data, rows);
+
+    qsort(layout->placements, (size_t)layout->count, sizeof(ObjectPlacement), ComparePlacements);
+    return true;
+}
+
+void UnloadObjectLayout(ObjectLayout* layout, EntityManager* manager) {
+    if (!layout) return;
+    if (manager) ResetObjectLayout(layout, manager, true);
+    free(layout->placements);
+    free(layout->spawned);
+    free(layout->state);
+    memset(layout, 0, sizeof(ObjectLayout));
+}
+
+void UpdateObjectLayout(ObjectLayout* layout, EntityManager* manager, float viewLeft, float viewRight) {
+    if (!layout || !manager || layout->count == 0) return;
+
+    float left = viewLeft - layout->margin;
+    float right = viewRight + layout->margin;
+
+    // First update or a jump with no overlap (respawn, debug camera): place the cursors directly
+    if (!layout->primed || right < layout->windowLeft || left > layout->windowRight) {
+        for (int i = layout->leftCursor; i < layout->rightCursor; i++) {
+            DespawnPlacement(layout, manager, i);
+        }
+        layout->leftCursor = FindPlacement(layout, left, false);
+        layout->rightCursor = FindPlacement(layout, right, true);
+        for (int i = layout->leftCursor; i < layout->rightCursor; i++) {
+            SpawnPlacement(layout, manager, i);
+        }
+    } else {
+        // Right edge
+        while (layout->rightCursor < layout->count && (float)layout->placements[layout->rightCursor].x <= right) {
+            SpawnPlacement(layout, manager, layout->rightCursor++);
+        }
+        while (layout->rightCursor > layout->leftCursor && (float)layout->placements[layout->rightCursor - 1].x > right) {
+            DespawnPlacement(layout, manager, --layout->rightCursor);
+        }
+
+        // Left edge
+        while (layout->leftCursor > 0 && (float)layout->placements[layout->leftCursor - 1].x >= left) {
+            SpawnPlacement(layout, manager, --layout->leftCursor);
+        }
+        while (layout->leftCursor < layout->rightCursor && (float)layout->placements[layout->leftCursor].x < left) {
+            DespawnPlacement(layout, manager, layout->leftCursor++);
+        }
+    }
+
+    layout->windowLeft = left;
+    layout->windowRight = right;
+    layout->primed = true;
+}
+
+// Despawns everything; the next update places the cursors from scratch
+void ResetObjectLayout(ObjectLayout* layout, EntityManager* manager, bool clearState) {
+    if (!layout || !manager) return;
+    for (int i = layout->leftCursor; i < layout->rightCursor; i++) {
+        DespawnPlacement(layout, manager, i);
+    }
+    layout->leftCursor = 0;
+    layout->rightCursor = 0;
+    layout->primed = false;
+    if (clearState && layout->state) memset(layout->state, 0, (size_t)layout->count);
+}
+
+uint8_t GetObjectState(const ObjectLayout* layout, int placement) {
+    if (!layout || placement < 0 || placement >= layout->count) return 0;
+    return layout->state[placement];
+}
+
+void SetObjectState(ObjectLayout* layout, int placement, uint8_t bits) {
+    if (!layout || placement < 0 || placement >= layout->count) return;
+    layout->state[placement] = bits;
+}
+
+void RemoveObjectPlacement(ObjectLayout* layout, EntityManager* manager, int placement) {
+    if (!layout || !manager || placement < 0 || placement >= layout->count) return;
+    layout->state[placement] |= OBJECT_STATE_REMOVED;
+    DespawnPlacement(layout, manager, placement);
+}
+
+int GetSpawnedObjectCount(const ObjectLayout* layout) {
+    if (!layout) return 0;
+    int count = 0;
+    for (int i = layout->leftCursor; i < layout->rightCursor; i++) {
+        if (layout->spawned[i] != ENTITY_HANDLE_NULL) count++;
+    }
+    return count;
+}
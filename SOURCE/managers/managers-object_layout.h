@@ -0,0 +1,62 @@
+// Object layout header
+#ifndef MANAGERS_OBJECT_LAYOUT_H
+#define MANAGERS_OBJECT_LAYOUT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "raylib.h"
+#include "managers-entity.h"
+
+// Per-placement state bits that survive despawning. The low bits are free for
+// object types to use (e.g. a monitor that was already broken).
+#define OBJECT_STATE_REMOVED 0x80 // Never spawn this placement again
+
+#define OBJECT_LAYOUT_DEFAULT_MARGIN 128.0f // Pixels beyond each side of the view
+
+typedef struct {
+    int x, y;
+    int type;
+    int subtype;
+} ObjectPlacement;
+
+// Creates the entity for a placement, returns ENTITY_HANDLE_NULL to skip it
+typedef EntityHandle (*ObjectSpawnFunc)(EntityManager* manager, const ObjectPlacement* placement);
+
+// Default spawn: a debug marker, a coloured circle with a collider per object type
+EntityHandle SpawnObjectMarker(EntityManager* manager, const ObjectPlacement* placement);
+
+// Level object placements sorted by X. Two cursors bracket the placements
+// inside the camera window (plus margin) and only those are spawned into the
+// entity pool; as the camera moves the cursors step forward or back,
+// spawning what enters and despawning what leaves. Per-frame cost depends
+// on the window, not on the zone's object count.
+typedef struct {
+    ObjectPlacement* placements;
+    EntityHandle* spawned;  // Live entity per placement, ENTITY_HANDLE_NULL when despawned
+    uint8_t* state;         // Persistent state bits per placement
+    int count;
+
+    int leftCursor;         // First placement inside the window
+    int rightCursor;        // First placement right of the window
+    float windowLeft;
+    float windowRight;
+    bool primed;
+
+    float margin;
+    ObjectSpawnFunc spawn;  // NULL uses SpawnObjectMarker
+} ObjectLayout;
+
+// CSV rows: type,x,y,subtype
+bool LoadObjectLayout(ObjectLayout* layout, const char* filePath);
+void UnloadObjectLayout(ObjectLayout* layout, EntityManager* manager);
+void UpdateObjectLayout(ObjectLayout* layout, EntityManager* manager, float viewLeft, float viewRight);
+void ResetObjectLayout(ObjectLayout* layout, EntityManager* manager, bool clearState);
+
+uint8_t GetObjectState(const ObjectLayout* layout, int placement);
+void SetObjectState(ObjectLayout* layout, int placement, uint8_t bits);
+// Despawns a placement and marks it OBJECT_STATE_REMOVED (collected, destroyed)
+void RemoveObjectPlacement(ObjectLayout* layout, EntityManager* manager, int placement);
+int GetSpawnedObjectCount(const ObjectLayout* layout);
+
+#endif // MANAGERS_OBJECT_LAYOUT_H
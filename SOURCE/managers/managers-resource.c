@@ -0,0 +1,182 @@
+// Resource cache
+#include "managers-resource.h"
+#include <string.h>
+
+ResourceManager gResourceManager;
+
+static uint32_t HashResourcePath(const char* path) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (const unsigned char* c = (const unsigned char*)path; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int FindResource(const char* path, uint32_t hash, ResourceType type) {
+    int index = gResourceManager.buckets[hash & (RESOURCE_BUCKET_COUNT - 1)];
+    while (index >= 0) {
+        CachedResource* entry = &gResourceManager.entries[index];
+        if (entry->hash == hash && entry->type == type && strcmp(entry->path, path) == 0) {
+            return index;
+        }
+        index = entry->next;
+    }
+    return -1;
+}
+
+static int InsertResource(const char* path, uint32_t hash, ResourceType type) {
+    for (int i = 0; i < MAX_CACHED_RESOURCES; i++) {
+        CachedResource* entry = &gResourceManager.entries[i];
+        if (entry->used) continue;
+
+        size_t length = strlen(path);
+        entry->path = (char*)malloc(length + 1);
+        if (entry->path == NULL) {
+            printf("Error: Memory allocation for resource path failed.\n");
+            return -1;
+        }
+        memcpy(entry->path, path, length + 1);
+        entry->hash = hash;
+        entry->type = type;
+        entry->refCount = 1;
+        entry->idleTime = 0.0f;
+        entry->used = true;
+
+        int bucket = hash & (RESOURCE_BUCKET_COUNT - 1);
+        entry->next = gResourceManager.buckets[bucket];
+        gResourceManager.buckets[bucket] = i;
+        gResourceManager.count++;
+        return i;
+    }
+    printf("Warning: Resource cache full, %s will not be shared.\n", path);
+    return -1;
+}
+
+static void EvictResource(int index) {
+    CachedResource* entry = &gResourceManager.entries[index];
+
+    // Unlink from its bucket chain
+    int* link = &gResourceManager.buckets[entry->hash & (RESOURCE_BUCKET_COUNT - 1)];
+    while (*link >= 0 && *link != index) {
+        link = &gResourceManager.entries[*link].next;
+    }
+    if (*link == index) *link = entry->next;
+
+    if (entry->type == RESOURCE_TEXTURE) {
+        UnloadTexture(entry->texture);
+    } else {
+        UnloadSound(entry->sound);
+    }
+    free(entry->path);
+    memset(entry, 0, sizeof(CachedResource));
+    entry->next = -1;
+    gResourceManager.count--;
+}
+
+static void ReleaseResource(int index) {
+    CachedResource* entry = &gResourceManager.entries[index];
+    if (entry->refCount > 0) {
+        entry->refCount--;
+        entry->idleTime = 0.0f;
+    }
+}
+
+void InitResourceManager(void) {
+    memset(&gResourceManager, 0, sizeof(ResourceManager));
+    for (int i = 0; i < RESOURCE_BUCKET_COUNT; i++) {
+        gResourceManager.buckets[i] = -1;
+    }
+    for (int i = 0; i < MAX_CACHED_RESOURCES; i++) {
+        gResourceManager.entries[i].next = -1;
+    }
+}
+
+void UpdateResourceManager(float deltaTime) {
+    for (int i = 0; i < MAX_CACHED_RESOURCES; i++) {
+        CachedResource* entry = &gResourceManager.entries[i];
+        if (!entry->used || entry->refCount > 0) continue;
+
+        entry->idleTime += deltaTime;
+        if (entry->idleTime >= RESOURCE_UNLOAD_GRACE_TIME) {
+            EvictResource(i);
+        }
+    }
+}
+
+void UnloadResourceManager(void) {
+    for (int i = 0; i < MAX_CACHED_RESOURCES; i++) {
+        if (!gResourceManager.entries[i].used) continue;
+        if (gResourceManager.entries[i].refCount > 0) {
+            printf("Warning: %s still has %d reference(s) at shutdown.\n",
+                   gResourceManager.entries[i].path, gResourceManager.entries[i].refCount);
+        }
+        EvictResource(i);
+    }
+    printf("Resource cache: %d hits, %d misses\n", gResourceManager.hits, gResourceManager.misses);
+}
+
+Texture2D LoadCachedTexture(const char* path) {
+    if (path == NULL) return (Texture2D){ 0 };
+
+    uint32_t hash = HashResourcePath(path);
+    int index = FindResource(path, hash, RESOURCE_TEXTURE);
+    if (index >= 0) {
+        gResourceManager.entries[index].refCount++;
+        gResourceManager.hits++;
+        return gResourceManager.entries[index].texture;
+    }
+
+    gResourceManager.misses++;
+    Texture2D texture = LoadTexture(path);
+    if (texture.id == 0) return texture; // Not cached so a later load can retry
+
+    index = InsertResource(path, hash, RESOURCE_TEXTURE);
+    if (index >= 0) gResourceManager.entries[index].texture = texture;
+    return texture;
+}
+
+Sound LoadCachedSound(const char* path) {
+    if (path == NULL) return (Sound){ 0 };
+
+    uint32_t hash = HashResourcePath(path);
+    int index = FindResource(path, hash, RESOURCE_SOUND);
+    if (index >= 0) {
+        gResourceManager.entries[index].refCount++;
+        gResourceManager.hits++;
+        return gResourceManager.entries[index].sound;
+    }
+
+    gResourceManager.misses++;
+    Sound sound = LoadSound(path);
+    if (sound.frameCount == 0) return sound;
+
+    index = InsertResource(path, hash, RESOURCE_SOUND);
+    if (index >= 0) gResourceManager.entries[index].sound = sound;
+    return sound;
+}
+
+void UnloadCachedTexture(Texture2D texture) {
+    if (texture.id == 0) return;
+    for (int i = 0; i < MAX_CACHED_RESOURCES; i++) {
+        CachedResource* entry = &gResourceManager.entries[i];
+        if (entry->used && entry->type == RESOURCE_TEXTURE && entry->texture.id == texture.id) {
+            ReleaseResource(i);
+            return;
+        }
+    }
+    UnloadTexture(texture);
+}
+
+void UnloadCachedSound(Sound sound) {
+    if (sound.frameCount == 0) return;
+    for (int i = 0; i < MAX_CACHED_RESOURCES; i++) {
+        CachedResource* entry = &gResourceManager.entries[i];
+        if (entry->used && entry->type == RESOURCE_SOUND && entry->sound.stream.buffer == sound.stream.buffer) {
+            ReleaseResource(i);
+            return;
+        }
+    }
+    UnloadSound(sound);
+}
@@ -0,0 +1,58 @@
+// Resource cache header
+#ifndef MANAGERS_RESOURCE_H
+#define MANAGERS_RESOURCE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "raylib.h"
+
+#define MAX_CACHED_RESOURCES 128
+#define RESOURCE_BUCKET_COUNT 64        // Power of two
+#define RESOURCE_UNLOAD_GRACE_TIME 5.0f // Seconds an unreferenced resource stays resident
+
+typedef enum {
+    RESOURCE_TEXTURE,
+    RESOURCE_SOUND
+} ResourceType;
+
+typedef struct {
+    uint32_t hash;
+    char* path;         // Interned copy of the path the resource was loaded from
+    ResourceType type;
+    Texture2D texture;
+    Sound sound;
+    int refCount;
+    float idleTime;     // Seconds since refCount dropped to zero
+    int next;           // Next entry in the same hash bucket, -1 terminates
+    bool used;
+} CachedResource;
+
+// Shared, reference-counted textures and sounds keyed by path. Releasing the
+// last reference doesn't unload right away: the resource stays resident for
+// RESOURCE_UNLOAD_GRACE_TIME so screen transitions and level restarts that load
+// it again hit memory instead of disk.
+typedef struct {
+    CachedResource entries[MAX_CACHED_RESOURCES];
+    int buckets[RESOURCE_BUCKET_COUNT];
+    int count;
+    int hits;
+    int misses;
+} ResourceManager;
+
+extern ResourceManager gResourceManager;
+
+void InitResourceManager(void);
+void UpdateResourceManager(float deltaTime);
+void UnloadResourceManager(void);
+
+// Returns a shared handle and takes a reference. Failed loads return an empty handle.
+Texture2D LoadCachedTexture(const char* path);
+Sound LoadCachedSound(const char* path);
+
+// Drops a reference. Handles that didn't come from the cache are unloaded immediately.
+void UnloadCachedTexture(Texture2D texture);
+void UnloadCachedSound(Sound sound);
+
+#endif // MANAGERS_RESOURCE_H
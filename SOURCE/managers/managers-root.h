@@ -2,9 +2,13 @@
 #pragma once
 #include "managers-screen.h"
 #include "managers-sprite.h"
+#include "managers-resource.h"
 #include "managers-audio.h"
 #include "managers-input.h"
 #include "managers-entity.h"
 #include "managers-screen_state.h"
 #include "managers-error_handler.h"
-#include "managers-screen_settings.h"
\ No newline at end of file
+#include "managers-screen_settings.h"
+#include "managers-sim_thread.h"
+#include "managers-object_layout.h"
+#include "managers-spatial_hash.h"
@@ -0,0 +1,123 @@
+// Simulation thread
+// Fixed-tick simulation with a lock-free triple-buffered snapshot handoff
+#define _POSIX_C_SOURCE 200809L // clock_gettime/nanosleep under -std=c2x
+#include "managers-sim_thread.h"
+#include <string.h>
+#include <time.h>
+
+#define SIM_SNAPSHOT_NEW 4      // Flag in readyIndex, buffer index in the low bits
+#define SIM_MAX_CATCH_UP 0.25   // Seconds of backlog before the tick clock resets
+
+static double SimNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void SimSleep(double seconds) {
+    struct timespec ts;
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - (double)ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+}
+
+static void* SimThreadMain(void* arg) {
+    SimThread* sim = (SimThread*)arg;
+    SetInputFrameOverride(&sim->tickInput);
+
+    double step = 1.0 / sim->tickRate;
+    double nextTick = SimNow();
+
+    while (atomic_load(&sim->running)) {
+        // Take the input gathered since the previous tick
+        pthread_mutex_lock(&sim->inputLock);
+        sim->tickInput = sim->pendingInput;
+        ClearInputFrameEdges(&sim->pendingInput);
+        pthread_mutex_unlock(&sim->inputLock);
+
+        sim->tick(sim->userData, (float)step, sim->buffers[sim->writeIndex]);
+
+        // Publish: the written buffer becomes ready, the previous ready one is ours to overwrite
+        int previous = atomic_exchange(&sim->readyIndex, sim->writeIndex | SIM_SNAPSHOT_NEW);
+        sim->writeIndex = previous & ~SIM_SNAPSHOT_NEW;
+
+        nextTick += step;
+        double now = SimNow();
+        if (now < nextTick) {
+            SimSleep(nextTick - now);
+        } else if (now - nextTick > SIM_MAX_CATCH_UP) {
+            nextTick = now; // Too far behind (breakpoint, suspend): don't fast-forward
+        }
+    }
+
+    SetInputFrameOverride(NULL);
+    return NULL;
+}
+
+bool SimThread_Start(SimThread* sim, size_t snapshotSize, float tickRate, SimThreadTick tick, void* userData) {
+    if (!sim || !tick || snapshotSize == 0 || tickRate <= 0.0f) return false;
+    memset(sim, 0, sizeof(SimThread));
+
+    for (int i = 0; i < 3; i++) {
+        sim->buffers[i] = calloc(1, snapshotSize);
+        if (!sim->buffers[i]) {
+            for (int j = 0; j < i; j++) free(sim->buffers[j]);
+            printf("Error: Failed to allocate simulation snapshots\n");
+            return false;
+        }
+    }
+
+    sim->snapshotSize = snapshotSize;
+    sim->writeIndex = 0;
+    sim->readIndex = 1;
+    atomic_init(&sim->readyIndex, 2);
+    sim->published = false;
+    sim->tickRate = tickRate;
+    sim->tick = tick;
+    sim->userData = userData;
+    pthread_mutex_init(&sim->inputLock, NULL);
+    atomic_init(&sim->running, true);
+
+    if (pthread_create(&sim->thread, NULL, SimThreadMain, sim) != 0) {
+        printf("Error: Failed to start simulation thread\n");
+        atomic_store(&sim->running, false);
+        pthread_mutex_destroy(&sim->inputLock);
+        for (int i = 0; i < 3; i++) free(sim->buffers[i]);
+        memset(sim, 0, sizeof(SimThread));
+        return false;
+    }
+    return true;
+}
+
+void SimThread_Stop(SimThread* sim) {
+    if (!sim || !sim->tick) return;
+
+    atomic_store(&sim->running, false);
+    pthread_join(sim->thread, NULL);
+    pthread_mutex_destroy(&sim->inputLock);
+    for (int i = 0; i < 3; i++) free(sim->buffers[i]);
+    memset(sim, 0, sizeof(SimThread));
+}
+
+bool SimThread_IsRunning(const SimThread* sim) {
+    return sim && sim->tick && atomic_load(&sim->running);
+}
+
+void SimThread_PushInput(SimThread* sim, const InputFrame* frame) {
+    if (!SimThread_IsRunning(sim) || !frame) return;
+
+    pthread_mutex_lock(&sim->inputLock);
+    AccumulateInputFrame(&sim->pendingInput, frame);
+    pthread_mutex_unlock(&sim->inputLock);
+}
+
+const void* SimThread_AcquireSnapshot(SimThread* sim) {
+    if (!SimThread_IsRunning(sim)) return NULL;
+
+    if (atomic_load(&sim->readyIndex) & SIM_SNAPSHOT_NEW) {
+        int ready = atomic_exchange(&sim->readyIndex, sim->readIndex);
+        sim->readIndex = ready & ~SIM_SNAPSHOT_NEW;
+        sim->published = true;
+    }
+    return sim->published ? sim->buffers[sim->readIndex] : NULL;
+}
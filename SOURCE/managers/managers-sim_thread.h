@@ -0,0 +1,54 @@
+// Simulation thread header
+#ifndef MANAGERS_SIM_THREAD_H
+#define MANAGERS_SIM_THREAD_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "raylib.h"
+#include "managers-input.h"
+
+// Fills `snapshot` with everything the renderer needs after one fixed step
+typedef void (*SimThreadTick)(void* userData, float deltaTime, void* snapshot);
+
+// Runs a simulation at a fixed tick rate on its own thread. Every tick writes
+// a complete snapshot into one of three buffers: the thread always has a free
+// buffer to write, and the main thread always reads the newest finished one
+// without either side waiting. Input reaches the simulation as InputFrames
+// pushed from the main thread; inside the tick, IsInput* and IsInputKey*
+// read that frame.
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t inputLock;
+    atomic_bool running;
+
+    void* buffers[3];
+    size_t snapshotSize;
+    int writeIndex;         // Owned by the simulation thread
+    int readIndex;          // Owned by the main thread
+    atomic_int readyIndex;  // Last published buffer, SIM_SNAPSHOT_NEW set until read
+    bool published;         // At least one snapshot has been read
+
+    InputFrame pendingInput; // Guarded by inputLock
+    InputFrame tickInput;    // Owned by the simulation thread
+
+    float tickRate;
+    SimThreadTick tick;
+    void* userData;
+} SimThread;
+
+bool SimThread_Start(SimThread* sim, size_t snapshotSize, float tickRate, SimThreadTick tick, void* userData);
+void SimThread_Stop(SimThread* sim);
+bool SimThread_IsRunning(const SimThread* sim);
+
+// Main thread: hand over this frame's input (edges accumulate until a tick consumes them)
+void SimThread_PushInput(SimThread* sim, const InputFrame* frame);
+
+// Main thread: newest published snapshot, or NULL before the first tick finished.
+// Stays valid until the next call.
+const void* SimThread_AcquireSnapshot(SimThread* sim);
+
+#endif // MANAGERS_SIM_THREAD_H
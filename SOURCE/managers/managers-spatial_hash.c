@@ -0,0 +1,249 @@
+// Spatial hash implementation
+// Broadphase for entity overlap queries
+#include "managers-spatial_hash.h"
+#include <string.h>
+#include <math.h>
+#include "../util/util-global.h"
+
+static inline int CellCoord(const SpatialHash* hash, float value) {
+    return (int)floorf(value / hash->cellSize);
+}
+
+static inline int PackCell(int cx, int cy) {
+    return (int)(((uint32_t)cx & 0xFFFFu) | ((uint32_t)cy << 16));
+}
+
+static inline int BucketOf(int cx, int cy) {
+    uint32_t h = (uint32_t)cx * 73856093u ^ (uint32_t)cy * 19349663u;
+    return (int)(h & (SPATIAL_HASH_BUCKETS - 1));
+}
+
+static inline bool BoundsOverlap(Rectangle a, Rectangle b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+// Cell range covered by a rectangle
+static void CellRange(const SpatialHash* hash, Rectangle r, int* minX, int* minY, int* maxX, int* maxY) {
+    *minX = CellCoord(hash, r.x);
+    *minY = CellCoord(hash, r.y);
+    *maxX = CellCoord(hash, r.x + r.width);
+    *maxY = CellCoord(hash, r.y + r.height);
+}
+
+// Same for stored items, clamped to SPATIAL_HASH_MAX_SPAN cells per axis
+static void ItemCellRange(const SpatialHash* hash, Rectangle r, int* minX, int* minY, int* maxX, int* maxY) {
+    CellRange(hash, r, minX, minY, maxX, maxY);
+    if (*maxX - *minX >= SPATIAL_HASH_MAX_SPAN || *maxY - *minY >= SPATIAL_HASH_MAX_SPAN) {
+        static bool warned = false;
+        if (!warned) {
+            printf("Warning: spatial hash item spans more than %d cells, queries past the first %d miss it\n",
+                   SPATIAL_HASH_MAX_SPAN, SPATIAL_HASH_MAX_SPAN);
+            warned = true;
+        }
+    }
+    if (*maxX - *minX >= SPATIAL_HASH_MAX_SPAN) *maxX = *minX + SPATIAL_HASH_MAX_SPAN - 1;
+    if (*maxY - *minY >= SPATIAL_HASH_MAX_SPAN) *maxY = *minY + SPATIAL_HASH_MAX_SPAN - 1;
+}
+
+static bool ReserveCellItems(SpatialHash* hash, int count) {
+    if (count <= hash->cellItemCapacity) return true;
+
+    int capacity = hash->cellItemCapacity ? hash->cellItemCapacity : 256;
+    while (capacity < count) capacity *= 2;
+    int* items = realloc(hash->cellItems, sizeof(int) * (size_t)capacity);
+    if (!items) return false;
+    hash->cellItems = items;
+    int* keys = realloc(hash->cellKeys, sizeof(int) * (size_t)capacity);
+    if (!keys) return false;
+    hash->cellKeys = keys;
+    hash->cellItemCapacity = capacity;
+    return true;
+}
+
+void InitSpatialHash(SpatialHash* hash, int cellTiles) {
+    if (!hash) return;
+    memset(hash, 0, sizeof(SpatialHash));
+    if (cellTiles <= 0) cellTiles = SPATIAL_HASH_DEFAULT_CELL_TILES;
+    hash->cellSize = (float)(cellTiles * TILE_SIZE);
+}
+
+void FreeSpatialHash(SpatialHash* hash) {
+    if (!hash) return;
+    free(hash->cellItems);
+    free(hash->cellKeys);
+    hash->cellItems = NULL;
+    hash->cellKeys = NULL;
+    hash->cellItemCapacity = 0;
+    hash->cellItemCount = 0;
+    hash->itemCount = 0;
+}
+
+// Counting sort of hash->items into their cells' buckets
+static void BinSpatialItems(SpatialHash* hash) {
+    // Count entries per bucket
+    memset(hash->bucketStart, 0, sizeof(hash->bucketStart));
+    int total = 0;
+    for (int i = 0; i < hash->itemCount; i++) {
+        int minX, minY, maxX, maxY;
+        ItemCellRange(hash, hash->items[i].bounds, &minX, &minY, &maxX, &maxY);
+        for (int cy = minY; cy <= maxY; cy++) {
+            for (int cx = minX; cx <= maxX; cx++) {
+                hash->bucketStart[BucketOf(cx, cy) + 1]++;
+                total++;
+            }
+        }
+    }
+    if (!ReserveCellItems(hash, total)) {
+        printf("Error: Failed to grow spatial hash\n");
+        hash->itemCount = 0;
+        hash->cellItemCount = 0;
+        memset(hash->bucketStart, 0, sizeof(hash->bucketStart));
+        return;
+    }
+    for (int b = 0; b < SPATIAL_HASH_BUCKETS; b++) {
+        hash->bucketStart[b + 1] += hash->bucketStart[b];
+    }
+
+    // Scatter (bucketStart is shifted back into place by the fill cursor)
+    int cursor[SPATIAL_HASH_BUCKETS];
+    memcpy(cursor, hash->bucketStart, sizeof(cursor));
+    for (int i = 0; i < hash->itemCount; i++) {
+        int minX, minY, maxX, maxY;
+        ItemCellRange(hash, hash->items[i].bounds, &minX, &minY, &maxX, &maxY);
+        for (int cy = minY; cy <= maxY; cy++) {
+            for (int cx = minX; cx <= maxX; cx++) {
+                int at = cursor[BucketOf(cx, cy)]++;
+                hash->cellItems[at] = i;
+                hash->cellKeys[at] = PackCell(cx, cy);
+            }
+        }
+    }
+    hash->cellItemCount = total;
+}
+
+void RebuildSpatialHash(SpatialHash* hash, const EntityManager* manager) {
+    if (!hash || !manager) return;
+
+    // Gather boxes from the collider array
+    const ComponentIndex* colliderIndex = &manager->componentIndex[COMPONENT_COLLIDER];
+    hash->itemCount = 0;
+    for (int i = 0; i < colliderIndex->count; i++) {
+        int slot = colliderIndex->denseSlot[i];
+        const Entity* entity = &manager->entities[manager->slotToDense[slot]];
+        if (!entity->active) continue;
+
+        SpatialItem* item = &hash->items[hash->itemCount];
+        if (!GetEntityBounds(manager, entity->id, &item->bounds)) continue;
+        item->handle = entity->id;
+        hash->itemCount++;
+    }
+
+    BinSpatialItems(hash);
+}
+
+// Same as RebuildSpatialHash for boxes that aren't entities (ids are caller defined)
+void RebuildSpatialHashFromBoxes(SpatialHash* hash, const Rectangle* bounds, const uint32_t* ids, int count) {
+    if (!hash || (count > 0 && (!bounds || !ids))) return;
+    if (count > MAX_ENTITIES) count = MAX_ENTITIES;
+
+    for (int i = 0; i < count; i++) {
+        hash->items[i] = (SpatialItem){ ids[i], bounds[i] };
+    }
+    hash->itemCount = count < 0 ? 0 : count;
+
+    BinSpatialItems(hash);
+}
+
+int QuerySpatialRect(SpatialHash* hash, Rectangle area, EntityHandle* results, int maxResults) {
+    if (!hash || !results || maxResults <= 0 || hash->itemCount == 0) return 0;
+
+    // New stamp so items spanning several cells are reported once
+    if (++hash->queryStamp == 0) {
+        memset(hash->itemStamp, 0, sizeof(hash->itemStamp));
+        hash->queryStamp = 1;
+    }
+
+    int minX, minY, maxX, maxY;
+    CellRange(hash, area, &minX, &minY, &maxX, &maxY);
+
+    int found = 0;
+    for (int cy = minY; cy <= maxY; cy++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            int bucket = BucketOf(cx, cy);
+            for (int e = hash->bucketStart[bucket]; e < hash->bucketStart[bucket + 1]; e++) {
+                int i = hash->cellItems[e];
+                if (hash->itemStamp[i] == hash->queryStamp) continue;
+                if (!BoundsOverlap(hash->items[i].bounds, area)) continue;
+
+                hash->itemStamp[i] = hash->queryStamp;
+                results[found++] = hash->items[i].handle;
+                if (found == maxResults) return found;
+            }
+        }
+    }
+    return found;
+}
+
+int QuerySpatialPoint(SpatialHash* hash, Vector2 point, EntityHandle* results, int maxResults) {
+    if (!hash || !results || maxResults <= 0) return 0;
+
+    int cx = CellCoord(hash, point.x);
+    int cy = CellCoord(hash, point.y);
+    int bucket = BucketOf(cx, cy);
+    int key = PackCell(cx, cy);
+
+    // A point lies in exactly one cell, so no stamps are needed
+    int found = 0;
+    for (int e = hash->bucketStart[bucket]; e < hash->bucketStart[bucket + 1]; e++) {
+        if (hash->cellKeys[e] != key) continue;
+        const SpatialItem* item = &hash->items[hash->cellItems[e]];
+        if (CheckCollisionPointRec(point, item->bounds)) {
+            results[found++] = item->handle;
+            if (found == maxResults) break;
+        }
+    }
+    return found;
+}
+
+// Every overlapping pair with at least one cell inside `region`. A pair can
+// share several cells; it is only reported from the cell holding the top-left
+// corner of the overlap, which makes the result duplicate free without stamps.
+int QuerySpatialPairs(const SpatialHash* hash, Rectangle region, SpatialPair* results, int maxResults) {
+    if (!hash || !results || maxResults <= 0 || hash->itemCount < 2) return 0;
+
+    int minX, minY, maxX, maxY;
+    CellRange(hash, region, &minX, &minY, &maxX, &maxY);
+
+    int found = 0;
+    for (int cy = minY; cy <= maxY; cy++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            int bucket = BucketOf(cx, cy);
+            int key = PackCell(cx, cy);
+            int begin = hash->bucketStart[bucket];
+            int end = hash->bucketStart[bucket + 1];
+
+            for (int e = begin; e < end; e++) {
+                if (hash->cellKeys[e] != key) continue;
+                const SpatialItem* a = &hash->items[hash->cellItems[e]];
+
+                for (int f = e + 1; f < end; f++) {
+                    if (hash->cellKeys[f] != key) continue;
+                    const SpatialItem* b = &hash->items[hash->cellItems[f]];
+                    if (!BoundsOverlap(a->bounds, b->bounds)) continue;
+
+                    // Overlaps starting left of/above the region belong to its first cell
+                    int ownerX = CellCoord(hash, fmaxf(a->bounds.x, b->bounds.x));
+                    int ownerY = CellCoord(hash, fmaxf(a->bounds.y, b->bounds.y));
+                    if (ownerX < minX) ownerX = minX;
+                    if (ownerY < minY) ownerY = minY;
+                    if (ownerX != cx || ownerY != cy) continue;
+
+                    results[found++] = (SpatialPair){ a->handle, b->handle };
+                    if (found == maxResults) return found;
+                }
+            }
+        }
+    }
+    return found;
+}
@@ -0,0 +1,61 @@
+// Spatial hash header
+#ifndef MANAGERS_SPATIAL_HASH_H
+#define MANAGERS_SPATIAL_HASH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "raylib.h"
+#include "managers-entity.h"
+
+#define SPATIAL_HASH_BUCKETS 1024       // Power of two
+#define SPATIAL_HASH_DEFAULT_CELL_TILES 4
+#define SPATIAL_HASH_MAX_SPAN 64        // Cells per axis one item is binned into
+
+typedef struct {
+    EntityHandle handle;
+    Rectangle bounds;
+} SpatialItem;
+
+typedef struct {
+    EntityHandle a, b;
+} SpatialPair;
+
+// Uniform grid of tile-aligned cells hashed into a fixed bucket table.
+// Rebuilt once per tick from entity colliders: items are binned into every
+// cell their AABB touches with a counting sort, so each bucket's entries are
+// contiguous and building is linear in the number of (item, cell) pairs.
+// Queries only visit the buckets under the query area and test the exact
+// AABBs, so overlap checks stay near-linear in the number of nearby objects.
+// An item covers at most SPATIAL_HASH_MAX_SPAN cells per axis (256 tiles at
+// the default cell size). Larger boxes keep only their top-left cells and
+// queries past those miss them (warned once), so keep huge boxes out.
+typedef struct {
+    float cellSize;
+
+    SpatialItem items[MAX_ENTITIES];
+    int itemCount;
+
+    int* cellItems;         // Item indices grouped by bucket
+    int* cellKeys;          // Packed cell of each entry, tells aliased cells apart
+    int cellItemCount;
+    int cellItemCapacity;
+    int bucketStart[SPATIAL_HASH_BUCKETS + 1];
+
+    uint32_t itemStamp[MAX_ENTITIES]; // Last query that reported each item
+    uint32_t queryStamp;
+} SpatialHash;
+
+void InitSpatialHash(SpatialHash* hash, int cellTiles);
+void FreeSpatialHash(SpatialHash* hash);
+
+// Rebuild from every entity with transform + collider components
+void RebuildSpatialHash(SpatialHash* hash, const EntityManager* manager);
+void RebuildSpatialHashFromBoxes(SpatialHash* hash, const Rectangle* bounds, const uint32_t* ids, int count);
+
+// Queries return the number of handles/pairs written (at most maxResults)
+int QuerySpatialRect(SpatialHash* hash, Rectangle area, EntityHandle* results, int maxResults);
+int QuerySpatialPoint(SpatialHash* hash, Vector2 point, EntityHandle* results, int maxResults);
+int QuerySpatialPairs(const SpatialHash* hash, Rectangle region, SpatialPair* results, int maxResults);
+
+#endif // MANAGERS_SPATIAL_HASH_H
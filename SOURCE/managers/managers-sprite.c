@@ -1,5 +1,9 @@
 // Sprite Manager
 #include "managers-sprite.h"
+#include "managers-resource.h"
+
+// Queue used by DrawSprites so sprites sharing a texture are drawn together
+static DrawQueue spriteQueue = {0};
 
 void InitSpriteManager(SpriteManager* manager) {
     if (manager == NULL) return;
@@ -22,7 +26,7 @@ void RemoveSprite(SpriteManager* manager, int spriteId) {
     if (manager == NULL) return;
     for (int i = 0; i < manager->spriteCount; i++) {
         if (manager->sprites[i] != NULL && manager->sprites[i]->id == spriteId) {
-            UnloadTexture(manager->sprites[i]->texture);
+            UnloadCachedTexture(manager->sprites[i]->texture);
             free(manager->sprites[i]);
             manager->sprites[i] = NULL;
             // Shift remaining sprites
@@ -50,18 +54,25 @@ void UpdateSprites(SpriteManager* manager, float deltaTime) {
     }
 }
 
-void DrawSprites(const SpriteManager* manager) {
-    if (manager == NULL) return;
+void SubmitSprites(const SpriteManager* manager, DrawQueue* queue, uint8_t layer) {
+    if (manager == NULL || queue == NULL) return;
     for (int i = 0; i < manager->spriteCount; i++) {
         SpriteObject* sprite = manager->sprites[i];
         if (sprite != NULL && sprite->visible) {
             Rectangle sourceRec = GetRectangleByFrameIndex(sprite->currentFrame);
             Vector2 origin = sprite->origin;
-            DrawTexturePro(sprite->texture, sourceRec, (Rectangle){ sprite->position.x, sprite->position.y, sourceRec.width * sprite->scale.x, sourceRec.height * sprite->scale.y }, origin, sprite->rotation, sprite->tint);
+            Rectangle destRec = { sprite->position.x, sprite->position.y, sourceRec.width * sprite->scale.x, sourceRec.height * sprite->scale.y };
+            DrawQueue_SubmitIndexed(queue, layer, 0, sprite->texture, sprite->palette, sourceRec, destRec, origin, sprite->rotation, sprite->tint);
         }
     }
 }
 
+void DrawSprites(const SpriteManager* manager) {
+    if (manager == NULL) return;
+    SubmitSprites(manager, &spriteQueue, DRAW_LAYER_OBJECTS);
+    DrawQueue_Flush(&spriteQueue);
+}
+
 Rectangle GetRectangleByFrameIndex(int frameIndex) {
     // Assuming each frame is 64x64 pixels for simplicity
     int frameWidth = 64;
@@ -72,8 +83,8 @@ Rectangle GetRectangleByFrameIndex(int frameIndex) {
 Texture2D GetTextureByAnimation(char* animationName) {
     (void)animationName; // Suppress unused parameter warning
     // Placeholder function: In a real implementation, this would look up the texture based on the animation name
-    // For now, return a dummy texture
-    Texture2D dummyTexture = LoadTexture("path/to/dummy.png");
+    // For now, return a dummy texture (shared through the resource cache, release with UnloadCachedTexture)
+    Texture2D dummyTexture = LoadCachedTexture("path/to/dummy.png");
     return dummyTexture;
 }
 
@@ -88,7 +99,7 @@ void LoadSprite(SpriteManager* manager, const char* filePath, int id, const char
     sprite->id = id;
     strncpy(sprite->name, name, MAX_SPRITE_NAME_LENGTH - 1);
     sprite->name[MAX_SPRITE_NAME_LENGTH - 1] = '\0';
-    sprite->texture = LoadTexture(filePath);
+    sprite->texture = LoadCachedTexture(filePath); // Shared between sprites using the same file
     if (sprite->texture.id == 0) {
         printf("Error: Failed to load texture from %s\n", filePath);
         free(sprite);
@@ -106,6 +117,7 @@ void LoadSprite(SpriteManager* manager, const char* filePath, int id, const char
     sprite->frameTimer = 0.0f;
     sprite->animating = false;
     sprite->origin = (Vector2){ 0.0f, 0.0f }; // Top-left by default
+    sprite->palette = -1; // Regular RGBA texture
 
     AddSprite(manager, sprite);
 }
@@ -114,7 +126,7 @@ void UnloadAllSprites(SpriteManager* manager) {
     if (manager == NULL) return;
     for (int i = 0; i < manager->spriteCount; i++) {
         if (manager->sprites[i] != NULL) {
-            UnloadTexture(manager->sprites[i]->texture);
+            UnloadCachedTexture(manager->sprites[i]->texture);
             free(manager->sprites[i]);
             manager->sprites[i] = NULL;
         }
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../entity/entity-sprite_object.h"
+#include "../visual/visual-draw_queue.h"
 
 #define MAX_SPRITES 256
 
@@ -21,6 +22,7 @@ void InitSpriteManager(SpriteManager* manager);
 void AddSprite(SpriteManager* manager, SpriteObject* sprite);
 void RemoveSprite(SpriteManager* manager, int spriteId);
 void UpdateSprites(SpriteManager* manager, float deltaTime);
+void SubmitSprites(const SpriteManager* manager, DrawQueue* queue, uint8_t layer);
 void DrawSprites(const SpriteManager* manager);
 Rectangle GetRectangleByFrameIndex(int frameIndex);
 Texture2D GetTextureByAnimation(char* animationName);
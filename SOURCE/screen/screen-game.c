@@ -4,13 +4,25 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <math.h>
+#include <stdatomic.h>
 #include "raylib.h"
 #include "../managers/managers-input.h"
+#include "../managers/managers-sim_thread.h"
+#include "../managers/managers-entity.h"
+#include "../managers/managers-object_layout.h"
+#include "../managers/managers-spatial_hash.h"
 #include "../managers/managers-screen_settings.h"
 #include "../entity/camera/camera-title_card.h"
 #include "../entity/camera/camera-hud.h"
 #include "../entity/player/player-player.h"
 #include "../entity/player/player-collision.h"
+#include "../entity/player/player-solid_objects.h"
+#include "../entity/player/player-path_swapper.h"
+#include "../entity/entity-ring_field.h"
+#include "../data/data-tile_flags.h"
+#include "../entity/entity-lost_rings.h"
+#include "../visual/visual-draw_queue.h"
 #include "../util/util-global.h"
 
 // Game state
@@ -18,13 +30,41 @@ static GameScreenState gameState = GAME_INIT;
 static float fadeAlpha = 0.0f;
 static float fadeDuration = 0.5f;
 static float fadeTimer = 0.0f;
-static bool titleCardFinished = false;
+static atomic_bool titleCardFinished = false;  // Set by the main thread, read by the simulation
+static atomic_bool requestTitle = false;       // Set by the simulation, screen switch on the main thread
+
+// Palette row the level tileset is indexed into
+#define GAME_TILESET_PALETTE 1
 
 // Level data
 static int** levelData = NULL;
 static int levelWidth = 0;
 static int levelHeight = 0;
+static int** levelPathB = NULL;  // Optional second collision path, same size as levelData
 static Texture2D tilesetTexture = {0};
+static int tilesetPalette = -1;  // GAME_TILESET_PALETTE once the tileset loaded as an index texture
+
+// World-space draw queue (tiles, objects, effects), flushed once per frame
+static DrawQueue worldQueue = {0};
+
+// Level objects: placements from the layout file, spawned around the camera
+static EntityManager objectEntities;
+static ObjectLayout objectLayout = {0};
+static SpatialHash objectHash;
+static int objectsCollected = 0; // Placements the player has collected this act
+
+// Rings live in their own packed store rather than as entities
+static RingField levelRings = {0};
+static LostRings lostRings;
+
+// Solidity bits for the collision tileset
+static TileFlagTable levelTileFlags;
+
+// Triggers that move the player between levelData and levelPathB
+static PathSwappers pathSwappers;
+
+// Platforms and other solid shapes the player sensors test besides the tiles
+static SolidObjects levelSolids;
 
 // Player
 static Player player;
@@ -35,19 +75,56 @@ static Camera2D camera = {0};
 static float cameraSpeed = 200.0f;
 static bool debugCameraMode = false;
 
+// Everything GameScreen_Draw reads, captured after each simulation step. The
+// draw side never touches the live simulation state, so the step can run on
+// its own thread (g_Options.threadedSimulation) and publish these through a
+// triple buffer.
+#define GAME_SNAPSHOT_MAX_OBJECTS 128
+#define GAME_SNAPSHOT_MAX_RINGS 256
+
+typedef struct {
+    Camera2D camera;
+    Player player;
+    GameScreenState state;
+    float fadeAlpha;
+    bool debugCameraMode;
+    int tileMinX, tileMinY, tileMaxX, tileMaxY; // Visible tile range, max exclusive
+    HUDValues hud;
+    int objectsCollected;
+    int objectCount;
+    struct { Vector2 position; float radius; Color color; } objects[GAME_SNAPSHOT_MAX_OBJECTS];
+    int ringCount;
+    int ringFrame;
+    RingPosition rings[GAME_SNAPSHOT_MAX_RINGS];
+} GameSnapshot;
+
+#define GAME_SIM_TICK_RATE 60.0f
+
+static SimThread simThread = {0};
+static GameSnapshot liveSnapshot;                 // Single-threaded mode
+static const GameSnapshot* drawSnapshot = NULL;  // What the next Draw shows
+
 // Forward declarations
 static void LoadTestLevel(void);
-static void DrawTileLayer(int** layer, int width, int height, Texture2D tileset);
+static EntityHandle SpawnGameObject(EntityManager* manager, const ObjectPlacement* placement);
+static void HandlePlayerContacts(const EntityHandle* touched, int count);
+static void DrawTileLayer(DrawQueue* queue, int** layer, int minX, int minY, int maxX, int maxY,
+                          Texture2D tileset, int palette);
 static void UpdateCameraFollow(void);
 static void UpdateCameraControls(float deltaTime);
+static void StepGame(float deltaTime);
+static void CaptureSnapshot(GameSnapshot* snapshot);
+static void GameSimTick(void* userData, float deltaTime, void* snapshot);
 
 void GameScreen_Init(void) {
     // Reset state
     gameState = GAME_INIT;
     fadeAlpha = 0.0f;
     fadeTimer = 0.0f;
-    titleCardFinished = false;
+    atomic_store(&titleCardFinished, false);
+    atomic_store(&requestTitle, false);
     debugCameraMode = false;
+    drawSnapshot = NULL;
 
     // Initialize camera
     camera.offset = (Vector2){ VIRTUAL_SCREEN_WIDTH / 2.0f, VIRTUAL_SCREEN_HEIGHT / 2.0f };
@@ -58,8 +135,13 @@ void GameScreen_Init(void) {
     // Load test level and tileset
     LoadTestLevel();
 
-    // Load tileset texture
-    tilesetTexture = LoadTexture("RESOURCES/sprite/spritesheet/tileset/SPGSolidTileHeightCollision.png");
+    // Load tileset texture, as palette indices when the palette shader is available
+    const char* tilesetPath = "RESOURCES/sprite/spritesheet/tileset/SPGSolidTileHeightCollision.png";
+    if (IsPaletteShaderReady()) {
+        tilesetTexture = LoadIndexedTexture(tilesetPath, GAME_TILESET_PALETTE);
+        if (tilesetTexture.id > 0) tilesetPalette = GAME_TILESET_PALETTE;
+    }
+    if (tilesetTexture.id == 0) tilesetTexture = LoadCachedTexture(tilesetPath);
     if (tilesetTexture.id == 0) {
         TraceLog(LOG_WARNING, "Failed to load tileset texture");
         // Create a simple colored rectangle as fallback
@@ -68,8 +150,44 @@ void GameScreen_Init(void) {
         UnloadImage(img);
     }
 
-    // Initialize collision system with level data
-    InitCollisionSystem(levelData, levelWidth, levelHeight);
+    // Initialize collision system with level data, path B falls back to path A
+    const char* pathBPath = "RESOURCES/data/levels/LEVEL_0/LEVEL_0_pathB.csv";
+    if (levelData && FileExists(pathBPath)) {
+        int pathBWidth = 0, pathBHeight = 0;
+        levelPathB = LoadCSVIntWithDimensions(pathBPath, &pathBWidth, &pathBHeight);
+        if (levelPathB && (pathBWidth != levelWidth || pathBHeight != levelHeight)) {
+            TraceLog(LOG_WARNING, "Path B layer is %dx%d, level is %dx%d; ignoring it",
+                     pathBWidth, pathBHeight, levelWidth, levelHeight);
+            FreeCSVData(levelPathB, pathBHeight);
+            levelPathB = NULL;
+        }
+    }
+    InitCollisionSystemPaths(levelData, levelPathB, levelWidth, levelHeight);
+    InitTileFlags(&levelTileFlags);
+    LoadTileFlags(&levelTileFlags, "RESOURCES/data/levels/LEVEL_0/SPGSolidTileHeightCollision.tsx", 1);
+    SetCollisionTileFlags(levelTileFlags.flags);
+    InitSolidObjects(&levelSolids);
+    SetCollisionSolidObjects(&levelSolids);
+
+    // Object placements (optional per level)
+    InitEntityManager(&objectEntities);
+    InitSpatialHash(&objectHash, SPATIAL_HASH_DEFAULT_CELL_TILES);
+    gEntityManager = &objectEntities;
+    const char* layoutPath = "RESOURCES/data/levels/LEVEL_0/LEVEL_0_objects.csv";
+    if (FileExists(layoutPath) && LoadObjectLayout(&objectLayout, layoutPath)) {
+        TraceLog(LOG_INFO, "Loaded %d object placements", objectLayout.count);
+    }
+    objectLayout.spawn = SpawnGameObject;
+    objectsCollected = 0;
+    ClearPathSwappers(&pathSwappers);
+    LoadPathSwappers(&pathSwappers, &objectLayout);
+    ClearLostRings(&lostRings);
+    const char* ringsPath = "RESOURCES/data/levels/LEVEL_0/LEVEL_0_rings.csv";
+    if (FileExists(ringsPath) && LoadRingField(&levelRings, ringsPath)) {
+        TraceLog(LOG_INFO, "Loaded %d rings", levelRings.count);
+    } else {
+        InitRingField(&levelRings, NULL, 0); // Still needed for the ring sprite (lost rings)
+    }
 
     // Initialize player at a starting position
     Vector2 playerStart = {100.0f, 100.0f};
@@ -85,6 +203,31 @@ void GameScreen_Init(void) {
     TitleCardCamera_Init(zoneName, actNumber);
 
     gameState = GAME_PLAYING;
+
+    // Everything the simulation reads is set up, hand it to its own thread
+    if (g_Options.threadedSimulation &&
+        !SimThread_Start(&simThread, sizeof(GameSnapshot), GAME_SIM_TICK_RATE, GameSimTick, NULL)) {
+        TraceLog(LOG_WARNING, "Falling back to single-threaded simulation");
+    }
+}
+
+// Path swappers are handled by pathSwappers, not as entities
+static EntityHandle SpawnGameObject(EntityManager* manager, const ObjectPlacement* placement) {
+    if (placement->type == PATH_SWAPPER_OBJECT_TYPE) return ENTITY_HANDLE_NULL;
+    return SpawnObjectMarker(manager, placement);
+}
+
+// Objects whose collider overlaps the player this step. Every layout object
+// is a collectable marker for now: touching one removes its placement for
+// good, so it stays gone when the camera window brings it back.
+static void HandlePlayerContacts(const EntityHandle* touched, int count) {
+    for (int i = 0; i < count; i++) {
+        Entity* entity = GetEntityById(&objectEntities, touched[i]);
+        if (!entity || entity->placement < 0) continue;
+
+        RemoveObjectPlacement(&objectLayout, &objectEntities, entity->placement);
+        objectsCollected++;
+    }
 }
 
 static void LoadTestLevel(void) {
@@ -158,24 +301,24 @@ static void UpdateCameraFollow(void) {
 
 static void UpdateCameraControls(float deltaTime) {
     // Camera movement with WASD in debug mode
-    if (IsKeyDown(KEY_D)) {
+    if (IsInputKeyDown(KEY_D)) {
         camera.target.x += cameraSpeed * deltaTime;
     }
-    if (IsKeyDown(KEY_A)) {
+    if (IsInputKeyDown(KEY_A)) {
         camera.target.x -= cameraSpeed * deltaTime;
     }
-    if (IsKeyDown(KEY_S)) {
+    if (IsInputKeyDown(KEY_S)) {
         camera.target.y += cameraSpeed * deltaTime;
     }
-    if (IsKeyDown(KEY_W)) {
+    if (IsInputKeyDown(KEY_W)) {
         camera.target.y -= cameraSpeed * deltaTime;
     }
 
     // Zoom controls
-    if (IsKeyPressed(KEY_EQUAL) || IsKeyPressed(KEY_KP_ADD)) {
+    if (IsInputKeyPressed(KEY_EQUAL) || IsInputKeyPressed(KEY_KP_ADD)) {
         camera.zoom *= 1.25f;
     }
-    if (IsKeyPressed(KEY_MINUS) || IsKeyPressed(KEY_KP_SUBTRACT)) {
+    if (IsInputKeyPressed(KEY_MINUS) || IsInputKeyPressed(KEY_KP_SUBTRACT)) {
         camera.zoom /= 1.25f;
     }
 
@@ -184,19 +327,11 @@ static void UpdateCameraControls(float deltaTime) {
     if (camera.zoom > 4.0f) camera.zoom = 4.0f;
 }
 
-void GameScreen_Update(float deltaTime) {
-    // Always update title card if active
-    if (titleCardState != TITLE_CARD_STATE_INACTIVE) {
-        TitleCardCamera_Update(deltaTime);
-
-        // Check if title card just finished
-        if (titleCardState == TITLE_CARD_STATE_INACTIVE && !titleCardFinished) {
-            titleCardFinished = true;
-        }
-    }
-
-    // Update HUD timer
-    UpdateHUD(deltaTime);
+// One simulation step. Runs on the simulation thread in threaded mode, so it
+// must not issue GL calls or read raylib input directly (use IsInput*).
+static void StepGame(float deltaTime) {
+    // Update HUD timer (the layer itself is refreshed on the main thread)
+    AdvanceHUDTimer(deltaTime);
 
     switch (gameState) {
         case GAME_INIT:
@@ -211,13 +346,31 @@ void GameScreen_Update(float deltaTime) {
 
         case GAME_PLAYING:
             // Toggle debug camera mode with Tab
-            if (IsKeyPressed(KEY_TAB)) {
+            if (IsInputKeyPressed(KEY_TAB)) {
                 debugCameraMode = !debugCameraMode;
             }
 
+            // Solid objects moved last step: publish their carry velocity and re-bin them
+            RebuildSolidObjects(&levelSolids);
+
             // Update player (only after title card finishes)
-            if (titleCardFinished && playerInitialized) {
+            if (atomic_load(&titleCardFinished) && playerInitialized) {
+                Vector2 previousPosition = player.position;
                 UpdatePlayer(&player, deltaTime);
+                UpdatePlayerPath(&pathSwappers, &player, previousPosition);
+                UpdatePlayerRings(&levelRings, &player);
+
+                int regained = CollectLostRings(&lostRings, player.position, player.widthRadius, player.heightRadius);
+                if (regained > 0) UpdateValues(0, 0, regained);
+            }
+            UpdateRingAnimation(&levelRings, deltaTime);
+            UpdateLostRings(&lostRings, deltaTime);
+
+            // Simulate a hit with H: drop every ring, scatter up to 32 of them
+            if (IsInputKeyPressed(KEY_H) && playerInitialized) {
+                int held = GetHUDValues().rings;
+                SpillRings(&lostRings, player.position, held);
+                UpdateValues(0, 0, -held);
             }
 
             // Update camera
@@ -227,13 +380,31 @@ void GameScreen_Update(float deltaTime) {
                 UpdateCameraFollow();
             }
 
+            // Spawn/despawn objects around the view, then run their systems
+            {
+                float halfWidth = VIRTUAL_SCREEN_WIDTH / (2.0f * camera.zoom);
+                UpdateObjectLayout(&objectLayout, &objectEntities,
+                                   camera.target.x - halfWidth, camera.target.x + halfWidth);
+                UpdateEntities(&objectEntities, deltaTime);
+
+                // Player vs objects; the hash queries test exact collider boxes
+                RebuildSpatialHash(&objectHash, &objectEntities);
+                Rectangle playerBounds = {
+                    player.position.x - player.widthRadius, player.position.y - player.heightRadius,
+                    player.widthRadius * 2.0f, player.heightRadius * 2.0f
+                };
+                EntityHandle touched[16];
+                int touchedCount = playerInitialized ? QuerySpatialRect(&objectHash, playerBounds, touched, 16) : 0;
+                HandlePlayerContacts(touched, touchedCount);
+            }
+
             // Reset player with R
-            if (IsKeyPressed(KEY_R) && playerInitialized) {
+            if (IsInputKeyPressed(KEY_R) && playerInitialized) {
                 ResetPlayer(&player, (Vector2){100.0f, 100.0f});
             }
 
             // Handle pause
-            if (IsInputPressed(INPUT_START) || IsKeyPressed(KEY_ESCAPE)) {
+            if (IsInputPressed(INPUT_START) || IsInputKeyPressed(KEY_ESCAPE)) {
                 gameState = GAME_PAUSED;
             }
 
@@ -246,7 +417,7 @@ void GameScreen_Update(float deltaTime) {
 
         case GAME_PAUSED:
             // Handle unpause
-            if (IsInputPressed(INPUT_START) || IsKeyPressed(KEY_ESCAPE)) {
+            if (IsInputPressed(INPUT_START) || IsInputKeyPressed(KEY_ESCAPE)) {
                 gameState = GAME_PLAYING;
             }
 
@@ -262,12 +433,106 @@ void GameScreen_Update(float deltaTime) {
             fadeAlpha = fadeTimer / fadeDuration;
             if (fadeTimer >= fadeDuration) {
                 fadeAlpha = 1.0f;
-                SetCurrentScreenGlobal(SCREEN_STATE_TITLE);
+                atomic_store(&requestTitle, true);
             }
             break;
     }
 }
 
+static void CaptureSnapshot(GameSnapshot* snapshot) {
+    snapshot->camera = camera;
+    snapshot->player = player;
+    snapshot->state = gameState;
+    snapshot->fadeAlpha = fadeAlpha;
+    snapshot->debugCameraMode = debugCameraMode;
+    snapshot->hud = GetHUDValues();
+    snapshot->objectsCollected = objectsCollected;
+
+    // Spawned objects that have something to draw
+    const ComponentIndex* shapeIndex = &objectEntities.componentIndex[COMPONENT_SHAPE];
+    const ComponentIndex* transformIndex = &objectEntities.componentIndex[COMPONENT_TRANSFORM];
+    int objectCount = 0;
+    int shape = 0;
+    for (; shape < shapeIndex->count && objectCount < GAME_SNAPSHOT_MAX_OBJECTS; shape++) {
+        uint16_t transform = transformIndex->sparse[shapeIndex->denseSlot[shape]];
+        if (transform == COMPONENT_NONE) continue;
+        snapshot->objects[objectCount].position = objectEntities.transforms[transform].position;
+        snapshot->objects[objectCount].radius = objectEntities.shapes[shape].radius;
+        snapshot->objects[objectCount].color = objectEntities.shapes[shape].color;
+        objectCount++;
+    }
+    snapshot->objectCount = objectCount;
+    static bool objectsClamped = false;
+    if (shape < shapeIndex->count && !objectsClamped) {
+        TraceLog(LOG_WARNING, "Snapshot holds %d objects, %d more are not drawn",
+                 GAME_SNAPSHOT_MAX_OBJECTS, shapeIndex->count - shape);
+        objectsClamped = true;
+    }
+
+    // Tiles under the view rectangle, so the renderer doesn't walk the whole level
+    float halfWidth = VIRTUAL_SCREEN_WIDTH / (2.0f * camera.zoom);
+    float halfHeight = VIRTUAL_SCREEN_HEIGHT / (2.0f * camera.zoom);
+    int minX = (int)floorf((camera.target.x - halfWidth) / TILE_SIZE);
+    int minY = (int)floorf((camera.target.y - halfHeight) / TILE_SIZE);
+    int maxX = (int)floorf((camera.target.x + halfWidth) / TILE_SIZE) + 1;
+    int maxY = (int)floorf((camera.target.y + halfHeight) / TILE_SIZE) + 1;
+    snapshot->tileMinX = minX < 0 ? 0 : minX;
+    snapshot->tileMinY = minY < 0 ? 0 : minY;
+    snapshot->tileMaxX = maxX > levelWidth ? levelWidth : maxX;
+    snapshot->tileMaxY = maxY > levelHeight ? levelHeight : maxY;
+
+    // Uncollected rings in view
+    Rectangle view = { camera.target.x - halfWidth, camera.target.y - halfHeight, halfWidth * 2.0f, halfHeight * 2.0f };
+    snapshot->ringCount = GatherVisibleRings(&levelRings, view, snapshot->rings, GAME_SNAPSHOT_MAX_RINGS);
+    snapshot->ringCount += GatherLostRings(&lostRings, snapshot->rings + snapshot->ringCount,
+                                           GAME_SNAPSHOT_MAX_RINGS - snapshot->ringCount);
+    static bool ringsClamped = false;
+    if (snapshot->ringCount == GAME_SNAPSHOT_MAX_RINGS && !ringsClamped) {
+        TraceLog(LOG_WARNING, "Snapshot ring list is full (%d), rings past it are not drawn", GAME_SNAPSHOT_MAX_RINGS);
+        ringsClamped = true;
+    }
+    snapshot->ringFrame = levelRings.frame;
+}
+
+static void GameSimTick(void* userData, float deltaTime, void* snapshot) {
+    (void)userData;
+    StepGame(deltaTime);
+    CaptureSnapshot((GameSnapshot*)snapshot);
+}
+
+void GameScreen_Update(float deltaTime) {
+    // Always update title card if active (main thread, it drives GPU-side effects)
+    if (titleCardState != TITLE_CARD_STATE_INACTIVE) {
+        TitleCardCamera_Update(deltaTime);
+
+        // Check if title card just finished
+        if (titleCardState == TITLE_CARD_STATE_INACTIVE) {
+            atomic_store(&titleCardFinished, true);
+        }
+    }
+
+    if (SimThread_IsRunning(&simThread)) {
+        // Hand this frame's input over and show the newest finished step
+        InputFrame frame;
+        CaptureInputFrame(&frame);
+        SimThread_PushInput(&simThread, &frame);
+        drawSnapshot = (const GameSnapshot*)SimThread_AcquireSnapshot(&simThread);
+    } else {
+        StepGame(deltaTime);
+        CaptureSnapshot(&liveSnapshot);
+        drawSnapshot = &liveSnapshot;
+    }
+
+    if (drawSnapshot) {
+        RefreshHUD(&drawSnapshot->hud);
+    }
+
+    // Screen switches unload this screen, so they only happen here
+    if (atomic_exchange(&requestTitle, false)) {
+        SetCurrentScreenGlobal(SCREEN_STATE_TITLE);
+    }
+}
+
 void GameScreen_Draw(void) {
     // Clear background
     ClearBackground((Color){135, 206, 250, 255}); // Sky blue
@@ -277,16 +542,37 @@ void GameScreen_Draw(void) {
         TitleCardCamera_DrawBackFade();
     }
 
-    BeginMode2D(camera);
+    // Nothing simulated yet (first frames of threaded mode)
+    const GameSnapshot* snap = drawSnapshot;
+    if (!snap) {
+        if (titleCardState != TITLE_CARD_STATE_INACTIVE) {
+            TitleCardCamera_Draw();
+            TitleCardCamera_DrawFrontFade();
+        }
+        return;
+    }
+    bool cardFinished = atomic_load(&titleCardFinished);
+
+    BeginMode2D(snap->camera);
 
     // Draw level tiles
     if (levelData && tilesetTexture.id > 0) {
-        DrawTileLayer(levelData, levelWidth, levelHeight, tilesetTexture);
+        DrawTileLayer(&worldQueue, levelData, snap->tileMinX, snap->tileMinY,
+                      snap->tileMaxX, snap->tileMaxY, tilesetTexture, tilesetPalette);
+    }
+
+    // Rings share the object layer and one animation frame
+    DrawRings(&levelRings, snap->rings, snap->ringCount, snap->ringFrame, &worldQueue);
+    DrawQueue_Flush(&worldQueue);
+
+    // Draw objects
+    for (int i = 0; i < snap->objectCount; i++) {
+        DrawCircleV(snap->objects[i].position, snap->objects[i].radius, snap->objects[i].color);
     }
 
     // Draw player
     if (playerInitialized) {
-        DrawPlayer(&player);
+        DrawPlayer(&snap->player);
     }
 
     // Draw grid for debugging (optional)
@@ -304,7 +590,7 @@ void GameScreen_Draw(void) {
     EndMode2D();
 
     // Draw HUD (only after title card exits or during display)
-    if (titleCardFinished || titleCardState == TITLE_CARD_STATE_INACTIVE) {
+    if (cardFinished || titleCardState == TITLE_CARD_STATE_INACTIVE) {
         DrawHUD();
     }
 
@@ -315,23 +601,25 @@ void GameScreen_Draw(void) {
     }
 
     // Draw debug info
-    if (playerInitialized && titleCardFinished) {
-        DrawText(TextFormat("Pos: %.1f, %.1f", player.position.x, player.position.y), 10, 30, 8, WHITE);
-        DrawText(TextFormat("Vel: %.2f, %.2f", player.velocity.x, player.velocity.y), 10, 40, 8, WHITE);
-        DrawText(TextFormat("GndSpd: %.2f", player.groundSpeed), 10, 50, 8, WHITE);
-        DrawText(TextFormat("Angle: %d (%.1f deg)", player.groundAngle, AngleByteToDegrees(player.groundAngle)), 10, 60, 8, WHITE);
-        DrawText(TextFormat("OnGround: %s", player.isOnGround ? "YES" : "NO"), 10, 70, 8, player.isOnGround ? GREEN : RED);
-        DrawText(TextFormat("State: %d", player.state), 10, 80, 8, WHITE);
+    if (playerInitialized && cardFinished) {
+        const Player* shown = &snap->player;
+        DrawText(TextFormat("Pos: %.1f, %.1f", shown->position.x, shown->position.y), 10, 30, 8, WHITE);
+        DrawText(TextFormat("Vel: %.2f, %.2f", shown->velocity.x, shown->velocity.y), 10, 40, 8, WHITE);
+        DrawText(TextFormat("GndSpd: %.2f", shown->groundSpeed), 10, 50, 8, WHITE);
+        DrawText(TextFormat("Angle: %d (%.1f deg)", shown->groundAngle, AngleByteToDegrees(shown->groundAngle)), 10, 60, 8, WHITE);
+        DrawText(TextFormat("OnGround: %s", shown->isOnGround ? "YES" : "NO"), 10, 70, 8, shown->isOnGround ? GREEN : RED);
+        DrawText(TextFormat("State: %d", shown->state), 10, 80, 8, WHITE);
+        DrawText(TextFormat("Objects collected: %d", snap->objectsCollected), 10, 90, 8, WHITE);
 
         // Controls help
-        const char* controls = debugCameraMode ?
-            "WASD: Camera  Arrows: Player  Z/Space: Jump  Down: Roll/Crouch  Tab: Player Cam  R: Reset  G: Grid" :
-            "Arrows: Move  Z/Space: Jump  Down: Roll/Crouch  Tab: Debug Cam  R: Reset  G: Grid  ESC: Pause";
+        const char* controls = snap->debugCameraMode ?
+            "WASD: Camera  Arrows: Player  Z/Space: Jump  Down: Roll/Crouch  Tab: Player Cam  R: Reset  H: Hurt  G: Grid" :
+            "Arrows: Move  Z/Space: Jump  Down: Roll/Crouch  Tab: Debug Cam  R: Reset  H: Hurt  G: Grid  ESC: Pause";
         DrawText(controls, 10, VIRTUAL_SCREEN_HEIGHT - 12, 8, WHITE);
     }
 
     // Draw UI elements (screen space)
-    if (gameState == GAME_PAUSED) {
+    if (snap->state == GAME_PAUSED) {
         DrawRectangle(0, 0, VIRTUAL_SCREEN_WIDTH, VIRTUAL_SCREEN_HEIGHT,
                      (Color){0, 0, 0, 128});
         const char* pauseText = "PAUSED";
@@ -341,14 +629,15 @@ void GameScreen_Draw(void) {
     }
 
     // Draw fade overlay
-    if (fadeAlpha > 0) {
+    if (snap->fadeAlpha > 0) {
         DrawRectangle(0, 0, VIRTUAL_SCREEN_WIDTH, VIRTUAL_SCREEN_HEIGHT,
-                     (Color){0, 0, 0, (unsigned char)(fadeAlpha * 255)});
+                     (Color){0, 0, 0, (unsigned char)(snap->fadeAlpha * 255)});
     }
 }
 
-static void DrawTileLayer(int** layer, int width, int height, Texture2D tileset) {
-    if (!layer || tileset.id == 0) return;
+static void DrawTileLayer(DrawQueue* queue, int** layer, int minX, int minY, int maxX, int maxY,
+                          Texture2D tileset, int palette) {
+    if (!queue || !layer || tileset.id == 0) return;
 
     // Calculate tiles per row in tileset (assuming 16x16 tiles in 256px wide texture)
     int tilesPerRow = tileset.width / TILE_SIZE;
@@ -359,8 +648,8 @@ static void DrawTileLayer(int** layer, int width, int height, Texture2D tileset)
     const uint32_t FLIPPED_DIAGONALLY_FLAG   = 0x20000000;
     const uint32_t TILE_ID_MASK              = 0x1FFFFFFF;
 
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
+    for (int y = minY; y < maxY; y++) {
+        for (int x = minX; x < maxX; x++) {
             int rawTileValue = layer[y][x];
 
             // Skip empty tiles (0 or exactly -1, but not other negative values which are flipped tiles)
@@ -403,12 +692,16 @@ static void DrawTileLayer(int** layer, int width, int height, Texture2D tileset)
             float rotation = flipD ? 90.0f : 0.0f;
             Vector2 origin = flipD ? (Vector2){0, (float)TILE_SIZE} : (Vector2){0, 0};
 
-            DrawTexturePro(tileset, source, dest, origin, rotation, WHITE);
+            DrawQueue_SubmitIndexed(queue, DRAW_LAYER_TILES, 0, tileset, palette, source, dest, origin, rotation, WHITE);
         }
     }
 }
 
 void GameScreen_Unload(void) {
+    // The simulation reads everything below, stop it first
+    SimThread_Stop(&simThread);
+    drawSnapshot = NULL;
+
     // Free level data
     if (levelData) {
         for (int y = 0; y < levelHeight; y++) {
@@ -417,18 +710,38 @@ void GameScreen_Unload(void) {
         free(levelData);
         levelData = NULL;
     }
+    if (levelPathB) {
+        FreeCSVData(levelPathB, levelHeight);
+        levelPathB = NULL;
+    }
 
     // Reset collision system
     InitCollisionSystem(NULL, 0, 0);
+    SetCollisionTileFlags(NULL);
+    SetCollisionSolidObjects(NULL);
+    FreeSolidObjects(&levelSolids);
+
+    // Drop object placements and whatever they spawned
+    UnloadObjectLayout(&objectLayout, &objectEntities);
+    FreeSpatialHash(&objectHash);
+    UnloadRingField(&levelRings);
+    if (gEntityManager == &objectEntities) gEntityManager = NULL;
 
     // Unload tileset texture
     if (tilesetTexture.id > 0) {
-        UnloadTexture(tilesetTexture);
+        if (tilesetPalette >= 0) {
+            UnloadTexture(tilesetTexture); // Index textures aren't shared through the cache
+        } else {
+            UnloadCachedTexture(tilesetTexture);
+        }
         tilesetTexture = (Texture2D){0};
+        tilesetPalette = -1;
     }
 
     playerInitialized = false;
 
+    DrawQueue_Free(&worldQueue);
+
     // Unload title card resources
     TitleCardCamera_Unload();
 
@@ -29,8 +29,8 @@ InitScreenPhase* currentPhase = NULL;
 
 void InitScreen_Init(void) {
     // Load resources
-    segaLogo = LoadTexture("RESOURCES/image/logos/Sega-logo.png");
-    segaJingle = LoadSound("RESOURCES/sound/sfx/jingle.ogg");
+    segaLogo = LoadCachedTexture("RESOURCES/image/logos/Sega-logo.png");
+    segaJingle = LoadCachedSound("RESOURCES/sound/sfx/jingle.ogg");
     
     // Check if sound loaded properly
     if (segaJingle.frameCount == 0) {
@@ -203,8 +203,8 @@ void InitScreen_Draw(void) {
 }
 
 void InitScreen_Unload(void) {
-    UnloadTexture(segaLogo);
-    UnloadSound(segaJingle);
+    UnloadCachedTexture(segaLogo);
+    UnloadCachedSound(segaJingle);
     free(logoPosition);
     free(initState);
     free(currentPhase);
@@ -5,6 +5,7 @@
 #include "raylib.h"
 #include "../util/util-global.h"
 #include "../visual/visual-sprite_fonts.h"
+#include "../visual/visual-backgrounds.h"
 #include "../managers/managers-input.h"
 #include "../managers/managers-screen_settings.h"
 
@@ -21,6 +22,9 @@ static float fadeAlpha = 255.0f;
 static float fadeDuration = 0.6f;
 static float fadeTimer = 0.0f;
 
+// Background
+static float backgroundScroll = 0.0f;
+
 // Menu state
 static int selectedOption = 0;
 static int scrollOffset = 0;
@@ -50,9 +54,9 @@ static void UpdateOptionValue(int index, int direction);
 
 void OptionsScreen_Init(void) {
     // Load sound effects
-    moveSound = LoadSound("RESOURCES/sound/sfx/Sonic World Sounds/004.wav");
-    acceptSound = LoadSound("RESOURCES/sound/sfx/Sonic World Sounds/022.wav");
-    backSound = LoadSound("RESOURCES/sound/sfx/Sonic World Sounds/002.wav");
+    moveSound = LoadCachedSound("RESOURCES/sound/sfx/Sonic World Sounds/004.wav");
+    acceptSound = LoadCachedSound("RESOURCES/sound/sfx/Sonic World Sounds/022.wav");
+    backSound = LoadCachedSound("RESOURCES/sound/sfx/Sonic World Sounds/002.wav");
 
     // Reset state
     optionsState = OPTIONS_FADE_IN;
@@ -61,6 +65,7 @@ void OptionsScreen_Init(void) {
     selectedOption = 0;
     scrollOffset = 0;
     inputRepeatTimer = 0.0f;
+    backgroundScroll = 0.0f;
 
     // Load options from global g_Options into local display items
     LoadOptionsData();
@@ -179,6 +184,8 @@ static void UpdateOptionValue(int index, int direction) {
 }
 
 void OptionsScreen_Update(float deltaTime) {
+    backgroundScroll += deltaTime * 12.0f;
+
     switch (optionsState) {
         case OPTIONS_FADE_IN:
             fadeTimer += deltaTime;
@@ -270,8 +277,17 @@ void OptionsScreen_Update(float deltaTime) {
 }
 
 void OptionsScreen_Draw(void) {
-    // Dark background
+    // Dark background with slowly scrolling stripes
     ClearBackground((Color){40, 40, 40, 255});
+    MenuBackground stripes = {
+        .type = MENU_BG_STRIPES,
+        .colorA = {40, 40, 40, 255},
+        .colorB = {48, 48, 48, 255},
+        .scroll = {backgroundScroll, 0.0f},
+        .scale = 16.0f,
+        .fade = 1.0f
+    };
+    DrawMenuBackground(&stripes, (Rectangle){0, 0, VIRTUAL_SCREEN_WIDTH, VIRTUAL_SCREEN_HEIGHT});
 
     // Draw title
     const char* title = "OPTIONS";
@@ -368,15 +384,15 @@ void OptionsScreen_Draw(void) {
 void OptionsScreen_Unload(void) {
     // Unload sounds safely
     if (moveSound.frameCount > 0) {
-        UnloadSound(moveSound);
+        UnloadCachedSound(moveSound);
         moveSound = (Sound){0};
     }
     if (acceptSound.frameCount > 0) {
-        UnloadSound(acceptSound);
+        UnloadCachedSound(acceptSound);
         acceptSound = (Sound){0};
     }
     if (backSound.frameCount > 0) {
-        UnloadSound(backSound);
+        UnloadCachedSound(backSound);
         backSound = (Sound){0};
     }
 }
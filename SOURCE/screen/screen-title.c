@@ -4,6 +4,7 @@
 #include "raylib.h"
 #include "../util/util-global.h"
 #include "../visual/visual-sprite_fonts.h"
+#include "../visual/visual-backgrounds.h"
 #include "../managers/managers-input.h"
 
 // Title screen variables
@@ -48,10 +49,10 @@ static float checkerScale = 32.0f;
 
 void TitleScreen_Init(void) {
     // Load resources
-    logoTexture = LoadTexture("RESOURCES/image/logos/Presto.png");
-    bounceSound = LoadSound("RESOURCES/sound/sfx/Sonic Jam S3/18.wav");  // Bounce sound
-    moveSound = LoadSound("RESOURCES/sound/sfx/Sonic World Sounds/004.wav");    // Menu move sound
-    acceptSound = LoadSound("RESOURCES/sound/sfx/Sonic World Sounds/022.wav");  // Menu accept sound
+    logoTexture = LoadCachedTexture("RESOURCES/image/logos/Presto.png");
+    bounceSound = LoadCachedSound("RESOURCES/sound/sfx/Sonic Jam S3/18.wav");  // Bounce sound
+    moveSound = LoadCachedSound("RESOURCES/sound/sfx/Sonic World Sounds/004.wav");    // Menu move sound
+    acceptSound = LoadCachedSound("RESOURCES/sound/sfx/Sonic World Sounds/022.wav");  // Menu accept sound
     titleMusic = LoadMusicStream("RESOURCES/sound/music/04. Digital Manual.mp3");
     titleMusic.looping = true;
     musicStarted = false;
@@ -75,19 +76,15 @@ void TitleScreen_Init(void) {
 }
 
 static void DrawCheckerboard(void) {
-    int cols = (int)(VIRTUAL_SCREEN_WIDTH / checkerScale) + 2;
-    int rows = (int)(VIRTUAL_SCREEN_HEIGHT / checkerScale) + 2;
-    Color color1 = {220, 220, 220, (unsigned char)(180 * checkerFade)};
-    Color color2 = {180, 180, 180, (unsigned char)(180 * checkerFade)};
-    
-    for (int y = 0; y < rows; y++) {
-        for (int x = 0; x < cols; x++) {
-            float px = x * checkerScale + fmodf(checkerScrollX, checkerScale) - checkerScale;
-            float py = y * checkerScale + fmodf(checkerScrollY, checkerScale) - checkerScale;
-            Color c = ((x + y) % 2 == 0) ? color1 : color2;
-            DrawRectangle((int)px, (int)py, (int)checkerScale, (int)checkerScale, c);
-        }
-    }
+    MenuBackground checkerboard = {
+        .type = MENU_BG_CHECKERBOARD,
+        .colorA = {220, 220, 220, 180},
+        .colorB = {180, 180, 180, 180},
+        .scroll = {checkerScrollX, checkerScrollY},
+        .scale = checkerScale,
+        .fade = checkerFade
+    };
+    DrawMenuBackground(&checkerboard, (Rectangle){0, 0, VIRTUAL_SCREEN_WIDTH, VIRTUAL_SCREEN_HEIGHT});
 }
 
 void TitleScreen_Update(float deltaTime) {
@@ -272,19 +269,19 @@ void TitleScreen_Draw(void) {
 }
 
 void TitleScreen_Unload(void) {
-    UnloadTexture(logoTexture);
+    UnloadCachedTexture(logoTexture);
     
     // Unload sounds safely - check if they're valid first
     if (bounceSound.frameCount > 0) {
-        UnloadSound(bounceSound);
+        UnloadCachedSound(bounceSound);
         bounceSound = (Sound){0}; // Clear the handle
     }
     if (moveSound.frameCount > 0) {
-        UnloadSound(moveSound);
+        UnloadCachedSound(moveSound);
         moveSound = (Sound){0}; // Clear the handle
     }
     if (acceptSound.frameCount > 0) {
-        UnloadSound(acceptSound);
+        UnloadCachedSound(acceptSound);
         acceptSound = (Sound){0}; // Clear the handle
     }
     
@@ -0,0 +1,147 @@
+// Procedural menu backgrounds implementation for Presto Framework Mini
+#include "visual-backgrounds.h"
+#include "visual-shaders.h"
+#include <math.h>
+
+static const char* backgroundFS =
+    "VARYING vec2 fragTexCoord;\n"
+    "VARYING vec4 fragColor;\n"
+    "uniform vec2 resolution;\n"
+    "uniform vec2 scroll;\n"
+    "uniform float cellSize;\n"
+    "uniform float fade;\n"
+    "uniform float pattern;\n"
+    "uniform vec4 colorA;\n"
+    "uniform vec4 colorB;\n"
+    "void main() {\n"
+    "    vec2 pixel = floor(fragTexCoord * resolution) - scroll;\n"
+    "    float t;\n"
+    "    if (pattern < 0.5) {\n"
+    "        vec2 cell = floor(pixel / cellSize);\n"
+    "        t = mod(cell.x + cell.y, 2.0);\n"
+    "    } else if (pattern < 1.5) {\n"
+    "        t = fragTexCoord.y;\n"
+    "    } else {\n"
+    "        t = step(0.5, fract((pixel.x + pixel.y) / (cellSize * 2.0)));\n"
+    "    }\n"
+    "    vec4 color = mix(colorA, colorB, t);\n"
+    "    FRAG_COLOR = vec4(color.rgb, color.a * fade) * fragColor;\n"
+    "}\n";
+
+static Shader backgroundShader = { 0 };
+static Texture2D whiteTexture = { 0 };
+static bool backgroundsLoaded = false;
+static bool shaderReady = false;
+
+static int resolutionLoc = -1;
+static int scrollLoc = -1;
+static int cellSizeLoc = -1;
+static int fadeLoc = -1;
+static int patternLoc = -1;
+static int colorALoc = -1;
+static int colorBLoc = -1;
+
+void InitMenuBackgrounds(void) {
+    if (backgroundsLoaded) return;
+
+    backgroundShader = LoadPortableShader(NULL, backgroundFS);
+    shaderReady = IsPortableShaderReady(backgroundShader, "pattern");
+    if (shaderReady) {
+        resolutionLoc = GetShaderLocation(backgroundShader, "resolution");
+        scrollLoc = GetShaderLocation(backgroundShader, "scroll");
+        cellSizeLoc = GetShaderLocation(backgroundShader, "cellSize");
+        fadeLoc = GetShaderLocation(backgroundShader, "fade");
+        patternLoc = GetShaderLocation(backgroundShader, "pattern");
+        colorALoc = GetShaderLocation(backgroundShader, "colorA");
+        colorBLoc = GetShaderLocation(backgroundShader, "colorB");
+    } else {
+        printf("Warning: Menu background shader unavailable, using CPU fallback\n");
+    }
+
+    // The pattern is drawn over a stretched 1x1 texture so fragTexCoord spans 0..1
+    Image white = GenImageColor(1, 1, WHITE);
+    whiteTexture = LoadTextureFromImage(white);
+    UnloadImage(white);
+
+    backgroundsLoaded = true;
+}
+
+static Vector4 ColorToVec4(Color color) {
+    return (Vector4){ color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+}
+
+static Color FadeColor(Color color, float fade) {
+    color.a = (unsigned char)(color.a * fade);
+    return color;
+}
+
+// Used when the shader failed to compile
+static void DrawMenuBackgroundCPU(const MenuBackground* background, Rectangle area) {
+    Color colorA = FadeColor(background->colorA, background->fade);
+    Color colorB = FadeColor(background->colorB, background->fade);
+
+    switch (background->type) {
+        case MENU_BG_CHECKERBOARD: {
+            float scale = background->scale;
+            int cols = (int)(area.width / scale) + 2;
+            int rows = (int)(area.height / scale) + 2;
+            float offsetX = fmodf(background->scroll.x, scale);
+            float offsetY = fmodf(background->scroll.y, scale);
+            for (int y = 0; y < rows; y++) {
+                for (int x = 0; x < cols; x++) {
+                    float px = area.x + x * scale + offsetX - scale;
+                    float py = area.y + y * scale + offsetY - scale;
+                    DrawRectangle((int)px, (int)py, (int)scale, (int)scale, ((x + y) % 2 == 0) ? colorA : colorB);
+                }
+            }
+            break;
+        }
+        case MENU_BG_GRADIENT:
+            DrawRectangleGradientV((int)area.x, (int)area.y, (int)area.width, (int)area.height, colorA, colorB);
+            break;
+        case MENU_BG_STRIPES:
+            DrawRectangleRec(area, colorA);
+            break;
+    }
+}
+
+void DrawMenuBackground(const MenuBackground* background, Rectangle area) {
+    if (!background || background->fade <= 0.0f) return;
+    InitMenuBackgrounds();
+
+    if (!shaderReady || background->scale <= 0.0f) {
+        DrawMenuBackgroundCPU(background, area);
+        return;
+    }
+
+    // Wrap the scroll so float precision holds however long the menu stays open
+    float period = background->scale * 2.0f;
+    Vector2 resolution = { area.width, area.height };
+    Vector2 scroll = { fmodf(background->scroll.x, period), fmodf(background->scroll.y, period) };
+    float pattern = (float)background->type;
+    Vector4 colorA = ColorToVec4(background->colorA);
+    Vector4 colorB = ColorToVec4(background->colorB);
+
+    SetShaderValue(backgroundShader, resolutionLoc, &resolution, SHADER_UNIFORM_VEC2);
+    SetShaderValue(backgroundShader, scrollLoc, &scroll, SHADER_UNIFORM_VEC2);
+    SetShaderValue(backgroundShader, cellSizeLoc, &background->scale, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(backgroundShader, fadeLoc, &background->fade, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(backgroundShader, patternLoc, &pattern, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(backgroundShader, colorALoc, &colorA, SHADER_UNIFORM_VEC4);
+    SetShaderValue(backgroundShader, colorBLoc, &colorB, SHADER_UNIFORM_VEC4);
+
+    BeginShaderMode(backgroundShader);
+    DrawTexturePro(whiteTexture, (Rectangle){ 0, 0, 1, 1 }, area, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    EndShaderMode();
+}
+
+void UnloadMenuBackgrounds(void) {
+    if (!backgroundsLoaded) return;
+
+    UnloadShader(backgroundShader);
+    UnloadTexture(whiteTexture);
+    backgroundShader = (Shader){ 0 };
+    whiteTexture = (Texture2D){ 0 };
+    shaderReady = false;
+    backgroundsLoaded = false;
+}
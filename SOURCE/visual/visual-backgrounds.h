@@ -0,0 +1,31 @@
+// Procedural menu backgrounds for Presto Framework Mini
+#pragma once
+
+#include "raylib.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+// Pattern drawn by the background shader
+typedef enum {
+    MENU_BG_CHECKERBOARD,   // Alternating colorA/colorB cells of `scale` pixels
+    MENU_BG_GRADIENT,       // Vertical colorA (top) to colorB (bottom)
+    MENU_BG_STRIPES         // Diagonal stripes, `scale` pixels wide
+} MenuBackgroundType;
+
+typedef struct {
+    MenuBackgroundType type;
+    Color colorA;
+    Color colorB;
+    Vector2 scroll;  // Pattern offset in pixels, grows freely (wrapped in the shader)
+    float scale;     // Cell/stripe size in pixels
+    float fade;      // 0..1, multiplies the colors' alpha
+} MenuBackground;
+
+// Loads the shared background shader. Called lazily by DrawMenuBackground.
+void InitMenuBackgrounds(void);
+
+// Fills x, y, width, height with the pattern in a single quad
+void DrawMenuBackground(const MenuBackground* background, Rectangle area);
+
+void UnloadMenuBackgrounds(void);
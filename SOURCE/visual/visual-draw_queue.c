@@ -0,0 +1,145 @@
+// 2D draw queue implementation for Presto Framework Mini
+#include "visual-draw_queue.h"
+#include "visual-palette.h"
+#include <string.h>
+
+// Sort key layout: layer (8 bits) | depth (8 bits) | palette + 1 (5 bits) | texture slot (11 bits)
+// The texture slot only groups quads; the flush compares real texture ids.
+static uint32_t MakeDrawKey(uint8_t layer, uint8_t depth, int palette, unsigned int textureId) {
+    return ((uint32_t)layer << 24) | ((uint32_t)depth << 16) |
+           ((uint32_t)(palette + 1) << 11) | (textureId & 0x7FF);
+}
+
+static bool GrowDrawQueue(DrawQueue* queue, size_t capacity) {
+    DrawCommand* commands = (DrawCommand*)realloc(queue->commands, sizeof(DrawCommand) * capacity);
+    if (!commands) return false;
+    queue->commands = commands;
+
+    uint32_t* keys = (uint32_t*)realloc(queue->keys, sizeof(uint32_t) * capacity);
+    if (!keys) return false;
+    queue->keys = keys;
+
+    uint32_t* order = (uint32_t*)realloc(queue->order, sizeof(uint32_t) * capacity);
+    if (!order) return false;
+    queue->order = order;
+
+    uint32_t* scratch = (uint32_t*)realloc(queue->scratch, sizeof(uint32_t) * capacity);
+    if (!scratch) return false;
+    queue->scratch = scratch;
+
+    queue->capacity = capacity;
+    return true;
+}
+
+void DrawQueue_Init(DrawQueue* queue, size_t initialCapacity) {
+    if (!queue) return;
+    memset(queue, 0, sizeof(DrawQueue));
+    if (initialCapacity > 0 && !GrowDrawQueue(queue, initialCapacity)) {
+        printf("Error: Failed to allocate draw queue\n");
+    }
+}
+
+void DrawQueue_Submit(DrawQueue* queue, uint8_t layer, uint8_t depth, Texture2D texture,
+                      Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    DrawQueue_SubmitIndexed(queue, layer, depth, texture, -1, source, dest, origin, rotation, tint);
+}
+
+void DrawQueue_SubmitIndexed(DrawQueue* queue, uint8_t layer, uint8_t depth, Texture2D texture, int palette,
+                             Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    if (!queue || texture.id == 0) return;
+    if (palette < -1 || palette >= PALETTE_COUNT) palette = -1;
+
+    if (queue->count >= queue->capacity) {
+        size_t capacity = (queue->capacity > 0) ? queue->capacity * 2 : 256;
+        if (!GrowDrawQueue(queue, capacity)) {
+            printf("Error: Failed to grow draw queue\n");
+            return;
+        }
+    }
+
+    size_t index = queue->count++;
+    queue->commands[index] = (DrawCommand){ texture, source, dest, origin, rotation, tint, palette };
+    queue->keys[index] = MakeDrawKey(layer, depth, palette, texture.id);
+}
+
+// LSD radix sort of command indices, 8 bits per pass. Counting sort is stable so
+// equal keys keep their submission order. Passes where every key shares the same
+// byte are skipped, which is the common case for the layer and depth bytes.
+void DrawQueue_Sort(DrawQueue* queue) {
+    if (!queue) return;
+
+    size_t count = queue->count;
+    uint32_t* src = queue->order;
+    uint32_t* dst = queue->scratch;
+    for (size_t i = 0; i < count; i++) src[i] = (uint32_t)i;
+    if (count < 2) return;
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        size_t histogram[256] = { 0 };
+        for (size_t i = 0; i < count; i++) {
+            histogram[(queue->keys[i] >> shift) & 0xFF]++;
+        }
+        if (histogram[(queue->keys[0] >> shift) & 0xFF] == count) continue;
+
+        size_t offset = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t n = histogram[b];
+            histogram[b] = offset;
+            offset += n;
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint32_t index = src[i];
+            dst[histogram[(queue->keys[index] >> shift) & 0xFF]++] = index;
+        }
+
+        uint32_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    // Keep the sorted order in queue->order
+    if (src != queue->order) {
+        memcpy(queue->order, src, sizeof(uint32_t) * count);
+    }
+}
+
+void DrawQueue_Flush(DrawQueue* queue) {
+    if (!queue) return;
+
+    DrawQueue_Sort(queue);
+
+    unsigned int lastTexture = 0;
+    int lastPalette = -1;
+    queue->lastBatchCount = 0;
+    for (size_t i = 0; i < queue->count; i++) {
+        const DrawCommand* cmd = &queue->commands[queue->order[i]];
+        if (cmd->palette != lastPalette) {
+            if (lastPalette >= 0) EndPaletteMode();
+            if (cmd->palette >= 0) BeginPaletteMode(cmd->palette);
+            lastPalette = cmd->palette;
+            lastTexture = 0; // Shader switch flushes the batch
+        }
+        if (cmd->texture.id != lastTexture) {
+            lastTexture = cmd->texture.id;
+            queue->lastBatchCount++;
+        }
+        DrawTexturePro(cmd->texture, cmd->source, cmd->dest, cmd->origin, cmd->rotation, cmd->tint);
+    }
+    if (lastPalette >= 0) EndPaletteMode();
+
+    queue->count = 0;
+}
+
+void DrawQueue_Clear(DrawQueue* queue) {
+    if (!queue) return;
+    queue->count = 0;
+}
+
+void DrawQueue_Free(DrawQueue* queue) {
+    if (!queue) return;
+    free(queue->commands);
+    free(queue->keys);
+    free(queue->order);
+    free(queue->scratch);
+    memset(queue, 0, sizeof(DrawQueue));
+}
@@ -0,0 +1,55 @@
+// 2D draw queue interface for Presto Framework Mini
+#pragma once
+
+#include "raylib.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Common layers, drawn back to front
+typedef enum {
+    DRAW_LAYER_BACKGROUND = 0,
+    DRAW_LAYER_TILES = 32,
+    DRAW_LAYER_OBJECTS = 64,
+    DRAW_LAYER_PLAYER = 96,
+    DRAW_LAYER_EFFECTS = 128,
+    DRAW_LAYER_HUD = 224
+} DrawLayer;
+
+// One textured quad, same parameters as DrawTexturePro
+typedef struct {
+    Texture2D texture;
+    Rectangle source;
+    Rectangle dest;
+    Vector2 origin;
+    float rotation;
+    Color tint;
+    int palette; // Palette row for indexed textures, -1 for regular RGBA textures
+} DrawCommand;
+
+// Commands are sorted by (layer, depth, palette, texture) with a stable radix
+// sort before drawing, so quads sharing a palette and texture end up adjacent
+// and raylib keeps them in one batch. The flush switches the palette shader
+// between runs. Submission order is preserved between equal keys.
+// A zero-initialized DrawQueue is valid and grows on first submit.
+typedef struct {
+    DrawCommand* commands;
+    uint32_t* keys;
+    uint32_t* order;
+    uint32_t* scratch;
+    size_t count;
+    size_t capacity;
+    int lastBatchCount; // Texture or palette switches during the last flush
+} DrawQueue;
+
+void DrawQueue_Init(DrawQueue* queue, size_t initialCapacity);
+void DrawQueue_Submit(DrawQueue* queue, uint8_t layer, uint8_t depth, Texture2D texture,
+                      Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+// Indexed texture drawn through `palette` (see visual-palette.h)
+void DrawQueue_SubmitIndexed(DrawQueue* queue, uint8_t layer, uint8_t depth, Texture2D texture, int palette,
+                             Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+void DrawQueue_Sort(DrawQueue* queue);
+void DrawQueue_Flush(DrawQueue* queue);
+void DrawQueue_Clear(DrawQueue* queue);
+void DrawQueue_Free(DrawQueue* queue);
@@ -1,9 +1,23 @@
 // 2D Visual Handler implementation for Presto Framework Mini
 #include "visual-handler_2d.h"
+#include "visual-shaders.h"
+#include "../util/util-global.h"
 #include <string.h>
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PRESTO_PARTICLES_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PRESTO_PARTICLES_NEON
+#endif
 
 // ===== SpriteHandler =====
 
+// Queue used by Handler2D_RenderSprites when the caller doesn't supply one
+static DrawQueue spriteQueue = {0};
+
 SpriteHandler* Handler2D_CreateSpriteHandler(void) {
     SpriteHandler* handler = (SpriteHandler*)malloc(sizeof(SpriteHandler));
     if (!handler) return NULL;
@@ -29,6 +43,7 @@ int Handler2D_AddSprite(SpriteHandler* handler, Texture2D texture, Vector2 posit
     handler->sprites[handler->spriteCount].scale = scale;
     handler->sprites[handler->spriteCount].tint = tint;
     handler->sprites[handler->spriteCount].sourceRect = (Rectangle){0, 0, texture.width, texture.height};
+    handler->sprites[handler->spriteCount].palette = -1;
     
     handler->spriteCount++;
     return handler->spriteCount - 1;
@@ -49,6 +64,7 @@ int Handler2D_AddSpriteSheet(SpriteHandler* handler, Texture2D texture, Vector2
     handler->sprites[handler->spriteCount].scale = scale;
     handler->sprites[handler->spriteCount].tint = tint;
     handler->sprites[handler->spriteCount].sourceRect = sourceRect;
+    handler->sprites[handler->spriteCount].palette = -1;
     
     handler->spriteCount++;
     return handler->spriteCount - 1;
@@ -62,8 +78,14 @@ void Handler2D_UpdateSprite(SpriteHandler* handler, int index, Vector2 position,
     handler->sprites[index].scale = scale;
 }
 
-void Handler2D_RenderSprites(SpriteHandler* handler, Vector2 cameraOffset) {
-    if (!handler) return;
+void Handler2D_SetSpritePalette(SpriteHandler* handler, int index, int palette) {
+    if (!handler || index < 0 || index >= (int)handler->spriteCount) return;
+
+    handler->sprites[index].palette = palette;
+}
+
+void Handler2D_SubmitSprites(SpriteHandler* handler, DrawQueue* queue, uint8_t layer, Vector2 cameraOffset) {
+    if (!handler || !queue) return;
     
     for (size_t i = 0; i < handler->spriteCount; i++) {
         SpriteInstance* sprite = &handler->sprites[i];
@@ -85,10 +107,17 @@ void Handler2D_RenderSprites(SpriteHandler* handler, Vector2 cameraOffset) {
             (sprite->sourceRect.height * sprite->scale.y) / 2.0f
         };
         
-        DrawTexturePro(sprite->texture, sprite->sourceRect, destRect, origin, sprite->rotation, sprite->tint);
+        DrawQueue_SubmitIndexed(queue, layer, 0, sprite->texture, sprite->palette, sprite->sourceRect, destRect, origin, sprite->rotation, sprite->tint);
     }
 }
 
+void Handler2D_RenderSprites(SpriteHandler* handler, Vector2 cameraOffset) {
+    if (!handler) return;
+
+    Handler2D_SubmitSprites(handler, &spriteQueue, DRAW_LAYER_OBJECTS, cameraOffset);
+    DrawQueue_Flush(&spriteQueue);
+}
+
 void Handler2D_DestroySpriteHandler(SpriteHandler* handler) {
     if (!handler) return;
     
@@ -100,12 +129,67 @@ void Handler2D_DestroySpriteHandler(SpriteHandler* handler) {
 
 // ===== BackgroundHandler =====
 
+#define BACKGROUND_DEFORM_TABLE_SIZE 64
+
+static const char* lineScrollFS =
+    "VARYING vec2 fragTexCoord;\n"
+    "VARYING vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform sampler2D rowOffsets;\n"
+    "uniform vec2 viewSize;\n"
+    "uniform vec2 textureSize;\n"
+    "uniform float offsetY;\n"
+    "uniform float repeating;\n"
+    "void main() {\n"
+    "    vec2 pixel = floor(fragTexCoord * viewSize);\n"
+    "    float offsetX = TEXTURE(rowOffsets, vec2((pixel.y + 0.5) / viewSize.y, 0.5)).r;\n"
+    "    vec2 uv = (pixel - vec2(offsetX, offsetY) + 0.5) / textureSize;\n"
+    "    if (repeating > 0.5) uv = fract(uv);\n"
+    "    else if (uv.x < 0.0 || uv.y < 0.0 || uv.x > 1.0 || uv.y > 1.0) discard;\n"
+    "    FRAG_COLOR = TEXTURE(texture0, uv) * colDiffuse * fragColor;\n"
+    "}\n";
+
+// One sine period, shared by every deformation type (Genesis-style table lookup)
+static float deformTable[BACKGROUND_DEFORM_TABLE_SIZE];
+static bool deformTableReady = false;
+
+static void BuildDeformTable(void) {
+    if (deformTableReady) return;
+    for (int i = 0; i < BACKGROUND_DEFORM_TABLE_SIZE; i++) {
+        deformTable[i] = sinf((float)i * 2.0f * PI / BACKGROUND_DEFORM_TABLE_SIZE);
+    }
+    deformTableReady = true;
+}
+
 BackgroundHandler* Handler2D_CreateBackgroundHandler(void) {
     BackgroundHandler* handler = (BackgroundHandler*)malloc(sizeof(BackgroundHandler));
     if (!handler) return NULL;
+    memset(handler, 0, sizeof(BackgroundHandler));
     
     handler->layers = NULL;
     handler->layerCount = 0;
+    handler->viewSize = (Vector2){ VIRTUAL_SCREEN_WIDTH, VIRTUAL_SCREEN_HEIGHT };
+    handler->rowOffsets = (float*)malloc(sizeof(float) * VIRTUAL_SCREEN_HEIGHT);
+    if (!handler->rowOffsets) {
+        free(handler);
+        return NULL;
+    }
+    handler->rowCapacity = VIRTUAL_SCREEN_HEIGHT;
+
+    handler->lineScrollShader = LoadPortableShader(NULL, lineScrollFS);
+    handler->shaderReady = IsPortableShaderReady(handler->lineScrollShader, "rowOffsets");
+    if (handler->shaderReady) {
+        handler->viewSizeLoc = GetShaderLocation(handler->lineScrollShader, "viewSize");
+        handler->textureSizeLoc = GetShaderLocation(handler->lineScrollShader, "textureSize");
+        handler->offsetYLoc = GetShaderLocation(handler->lineScrollShader, "offsetY");
+        handler->repeatingLoc = GetShaderLocation(handler->lineScrollShader, "repeating");
+        handler->rowOffsetsLoc = GetShaderLocation(handler->lineScrollShader, "rowOffsets");
+    } else {
+        printf("Warning: Line scroll shader unavailable, backgrounds are drawn per row\n");
+    }
+
+    BuildDeformTable();
     
     return handler;
 }
@@ -118,15 +202,56 @@ int Handler2D_AddLayer(BackgroundHandler* handler, Texture2D texture, Vector2 sc
     if (!newLayers) return -1;
     
     handler->layers = newLayers;
-    handler->layers[handler->layerCount].texture = texture;
-    handler->layers[handler->layerCount].position = (Vector2){0, 0};
-    handler->layers[handler->layerCount].scrollSpeed = scrollSpeed;
-    handler->layers[handler->layerCount].repeating = repeating;
+    BackgroundLayer* layer = &handler->layers[handler->layerCount];
+    memset(layer, 0, sizeof(BackgroundLayer));
+    layer->texture = texture;
+    layer->position = (Vector2){0, 0};
+    layer->scrollSpeed = scrollSpeed;
+    layer->repeating = repeating;
+    layer->parallax = (Vector2){1.0f, 1.0f};
+    layer->deformType = BACKGROUND_DEFORM_NONE;
     
     handler->layerCount++;
     return handler->layerCount - 1;
 }
 
+void Handler2D_SetLayerParallax(BackgroundHandler* handler, int index, Vector2 parallax) {
+    if (!handler || index < 0 || index >= (int)handler->layerCount) return;
+
+    handler->layers[index].parallax = parallax;
+}
+
+void Handler2D_SetLayerParallaxBand(BackgroundHandler* handler, int index, int firstRow, int rowCount, float factor) {
+    if (!handler || index < 0 || index >= (int)handler->layerCount) return;
+    BackgroundLayer* layer = &handler->layers[index];
+    int height = layer->texture.height;
+    if (height <= 0) return;
+
+    // Rows outside any band keep the layer-wide factor
+    if (!layer->rowParallax) {
+        layer->rowParallax = (float*)malloc(sizeof(float) * height);
+        if (!layer->rowParallax) return;
+        for (int row = 0; row < height; row++) layer->rowParallax[row] = layer->parallax.x;
+    }
+
+    int lastRow = firstRow + rowCount;
+    if (firstRow < 0) firstRow = 0;
+    if (lastRow > height) lastRow = height;
+    for (int row = firstRow; row < lastRow; row++) layer->rowParallax[row] = factor;
+}
+
+void Handler2D_SetLayerDeformation(BackgroundHandler* handler, int index, BackgroundDeformType type,
+                                   float amplitude, float speed, int startRow) {
+    if (!handler || index < 0 || index >= (int)handler->layerCount) return;
+    BackgroundLayer* layer = &handler->layers[index];
+
+    layer->deformType = type;
+    layer->deformAmplitude = amplitude;
+    layer->deformSpeed = speed;
+    layer->deformStartRow = startRow;
+    layer->deformPhase = 0.0f;
+}
+
 void Handler2D_UpdateBackground(BackgroundHandler* handler, float deltaTime) {
     if (!handler) return;
     
@@ -143,34 +268,134 @@ void Handler2D_UpdateBackground(BackgroundHandler* handler, float deltaTime) {
             if (layer->position.y >= layer->texture.height) layer->position.y -= layer->texture.height;
             if (layer->position.y <= -layer->texture.height) layer->position.y += layer->texture.height;
         }
+
+        if (layer->deformType != BACKGROUND_DEFORM_NONE) {
+            layer->deformPhase = fmodf(layer->deformPhase + layer->deformSpeed * deltaTime,
+                                       BACKGROUND_DEFORM_TABLE_SIZE);
+        }
+    }
+}
+
+static float WrapBackground(float value, float size) {
+    value = fmodf(value, size);
+    return (value < 0.0f) ? value + size : value;
+}
+
+static float GetDeformOffset(const BackgroundLayer* layer, int row) {
+    if (layer->deformType == BACKGROUND_DEFORM_NONE || row < layer->deformStartRow) return 0.0f;
+
+    // Heat haze steps through the table four times faster than water
+    int step = (layer->deformType == BACKGROUND_DEFORM_HEAT_HAZE) ? 4 : 1;
+    int index = (row * step + (int)layer->deformPhase) & (BACKGROUND_DEFORM_TABLE_SIZE - 1);
+    return deformTable[index] * layer->deformAmplitude;
+}
+
+// Fills handler->rowOffsets with the horizontal offset of every screen row
+static void BuildRowOffsets(BackgroundHandler* handler, const BackgroundLayer* layer,
+                            Vector2 cameraOffset, float offsetY) {
+    int rows = (int)handler->viewSize.y;
+    float width = (float)layer->texture.width;
+    int height = layer->texture.height;
+
+    for (int y = 0; y < rows; y++) {
+        float factor = layer->parallax.x;
+        if (layer->rowParallax) {
+            int textureRow = (int)floorf((float)y - offsetY);
+            if (layer->repeating) textureRow = ((textureRow % height) + height) % height;
+            if (textureRow >= 0 && textureRow < height) factor = layer->rowParallax[textureRow];
+        }
+
+        float x = layer->position.x - cameraOffset.x * factor + GetDeformOffset(layer, y);
+        handler->rowOffsets[y] = layer->repeating ? WrapBackground(x, width) : x;
+    }
+}
+
+// Fallback: one texture strip per screen row, all batched on the same texture
+static void DrawLayerRows(BackgroundHandler* handler, const BackgroundLayer* layer, float offsetY) {
+    int rows = (int)handler->viewSize.y;
+    float width = (float)layer->texture.width;
+    int height = layer->texture.height;
+
+    for (int y = 0; y < rows; y++) {
+        int textureRow = (int)floorf((float)y - offsetY);
+        if (layer->repeating) textureRow = ((textureRow % height) + height) % height;
+        else if (textureRow < 0 || textureRow >= height) continue;
+
+        Rectangle source = { 0, (float)textureRow, width, 1 };
+        float x = handler->rowOffsets[y];
+        if (!layer->repeating) {
+            DrawTextureRec(layer->texture, source, (Vector2){ x, (float)y }, WHITE);
+            continue;
+        }
+        for (x -= width; x < handler->viewSize.x; x += width) {
+            DrawTextureRec(layer->texture, source, (Vector2){ x, (float)y }, WHITE);
+        }
     }
 }
 
+// viewSize may change between frames; grow the row scratch to match
+static bool EnsureRowOffsets(BackgroundHandler* handler, int rows) {
+    if (rows <= handler->rowCapacity) return true;
+
+    float* rowOffsets = (float*)realloc(handler->rowOffsets, sizeof(float) * rows);
+    if (!rowOffsets) return false;
+    handler->rowOffsets = rowOffsets;
+    handler->rowCapacity = rows;
+    return true;
+}
+
+static bool EnsureOffsetTexture(BackgroundHandler* handler, BackgroundLayer* layer) {
+    if (layer->offsetTexture.id != 0 && layer->offsetTexture.width == (int)handler->viewSize.y) return true;
+
+    if (layer->offsetTexture.id != 0) UnloadTexture(layer->offsetTexture);
+    layer->offsetTexture = (Texture2D){ 0 };
+
+    Image image = {
+        .data = handler->rowOffsets,
+        .width = (int)handler->viewSize.y,
+        .height = 1,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R32
+    };
+    layer->offsetTexture = LoadTextureFromImage(image);
+    if (layer->offsetTexture.id == 0) return false;
+
+    SetTextureFilter(layer->offsetTexture, TEXTURE_FILTER_POINT);
+    return true;
+}
+
 void Handler2D_RenderBackground(BackgroundHandler* handler, Vector2 cameraOffset) {
-    if (!handler) return;
+    if (!handler || handler->viewSize.y < 1.0f) return;
+    if (!EnsureRowOffsets(handler, (int)handler->viewSize.y)) return;
     
+    Rectangle view = { 0, 0, handler->viewSize.x, handler->viewSize.y };
     for (size_t i = 0; i < handler->layerCount; i++) {
         BackgroundLayer* layer = &handler->layers[i];
+        if (layer->texture.width <= 0 || layer->texture.height <= 0) continue;
         
-        float x = layer->position.x - cameraOffset.x;
-        float y = layer->position.y - cameraOffset.y;
-        
-        if (layer->repeating) {
-            // Draw tiled background
-            int tilesX = (GetScreenWidth() / layer->texture.width) + 2;
-            int tilesY = (GetScreenHeight() / layer->texture.height) + 2;
-            
-            for (int ty = -1; ty < tilesY; ty++) {
-                for (int tx = -1; tx < tilesX; tx++) {
-                    DrawTexture(layer->texture, 
-                               x + (tx * layer->texture.width), 
-                               y + (ty * layer->texture.height), 
-                               WHITE);
-                }
-            }
-        } else {
-            DrawTexture(layer->texture, x, y, WHITE);
+        float offsetY = layer->position.y - cameraOffset.y * layer->parallax.y;
+        if (layer->repeating) offsetY = WrapBackground(offsetY, (float)layer->texture.height);
+        BuildRowOffsets(handler, layer, cameraOffset, offsetY);
+
+        if (!handler->shaderReady || !EnsureOffsetTexture(handler, layer)) {
+            DrawLayerRows(handler, layer, offsetY);
+            continue;
         }
+        UpdateTexture(layer->offsetTexture, handler->rowOffsets);
+
+        Vector2 textureSize = { (float)layer->texture.width, (float)layer->texture.height };
+        float repeating = layer->repeating ? 1.0f : 0.0f;
+
+        // Shader mode per layer so each flush sees its own offset texture
+        BeginShaderMode(handler->lineScrollShader);
+        SetShaderValue(handler->lineScrollShader, handler->viewSizeLoc, &handler->viewSize, SHADER_UNIFORM_VEC2);
+        SetShaderValue(handler->lineScrollShader, handler->textureSizeLoc, &textureSize, SHADER_UNIFORM_VEC2);
+        SetShaderValue(handler->lineScrollShader, handler->offsetYLoc, &offsetY, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(handler->lineScrollShader, handler->repeatingLoc, &repeating, SHADER_UNIFORM_FLOAT);
+        SetShaderValueTexture(handler->lineScrollShader, handler->rowOffsetsLoc, layer->offsetTexture);
+        DrawTexturePro(layer->texture, (Rectangle){ 0, 0, textureSize.x, textureSize.y }, view,
+                       (Vector2){ 0, 0 }, 0.0f, WHITE);
+        EndShaderMode();
     }
 }
 
@@ -178,26 +403,48 @@ void Handler2D_DestroyBackgroundHandler(BackgroundHandler* handler) {
     if (!handler) return;
     
     if (handler->layers) {
+        for (size_t i = 0; i < handler->layerCount; i++) {
+            free(handler->layers[i].rowParallax);
+            if (handler->layers[i].offsetTexture.id != 0) UnloadTexture(handler->layers[i].offsetTexture);
+        }
         free(handler->layers);
     }
+    if (IsShaderValid(handler->lineScrollShader)) {
+        UnloadShader(handler->lineScrollShader);
+    }
+    free(handler->rowOffsets);
     free(handler);
 }
 
 // ===== ParticleSystem =====
 
+#define PARTICLE_TEXTURE_SIZE 16
+
 ParticleSystem* Handler2D_CreateParticleSystem(size_t maxParticles) {
     ParticleSystem* system = (ParticleSystem*)malloc(sizeof(ParticleSystem));
     if (!system) return NULL;
-    
-    system->particles = (Particle*)malloc(sizeof(Particle) * maxParticles);
-    if (!system->particles) {
+    memset(system, 0, sizeof(ParticleSystem));
+
+    // One block for every array; capacity is padded to a multiple of 4 so each
+    // array starts 16-byte aligned and the SIMD kernel never straddles two arrays
+    size_t capacity = (maxParticles + 3) & ~(size_t)3;
+    float* block = (float*)malloc(capacity * (sizeof(float) * 7 + sizeof(Color)));
+    if (!block) {
         free(system);
         return NULL;
     }
-    
+
+    system->positionX = block;
+    system->positionY = block + capacity;
+    system->velocityX = block + capacity * 2;
+    system->velocityY = block + capacity * 3;
+    system->age = block + capacity * 4;
+    system->lifetime = block + capacity * 5;
+    system->size = block + capacity * 6;
+    system->color = (Color*)(block + capacity * 7);
     system->particleCount = 0;
     system->maxParticles = maxParticles;
-    
+
     return system;
 }
 
@@ -205,58 +452,133 @@ void Handler2D_EmitParticle(ParticleSystem* system, Vector2 position, Vector2 ve
                             Color color, float lifetime, float size) {
     if (!system || system->particleCount >= system->maxParticles) return;
     
-    Particle* p = &system->particles[system->particleCount];
-    p->position = position;
-    p->velocity = velocity;
-    p->color = color;
-    p->lifetime = lifetime;
-    p->age = 0.0f;
-    p->size = size;
+    size_t i = system->particleCount;
+    system->positionX[i] = position.x;
+    system->positionY[i] = position.y;
+    system->velocityX[i] = velocity.x;
+    system->velocityY[i] = velocity.y;
+    system->age[i] = 0.0f;
+    system->lifetime[i] = lifetime;
+    system->size[i] = size;
+    system->color[i] = color;
     
     system->particleCount++;
 }
 
+// position += velocity * dt, age += dt, four particles at a time where available
+static void IntegrateParticles(ParticleSystem* system, float deltaTime) {
+    size_t count = system->particleCount;
+    size_t i = 0;
+
+#if defined(PRESTO_PARTICLES_SSE)
+    __m128 dt = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(&system->positionX[i]);
+        __m128 py = _mm_loadu_ps(&system->positionY[i]);
+        __m128 vx = _mm_loadu_ps(&system->velocityX[i]);
+        __m128 vy = _mm_loadu_ps(&system->velocityY[i]);
+        __m128 age = _mm_loadu_ps(&system->age[i]);
+        _mm_storeu_ps(&system->positionX[i], _mm_add_ps(px, _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(&system->positionY[i], _mm_add_ps(py, _mm_mul_ps(vy, dt)));
+        _mm_storeu_ps(&system->age[i], _mm_add_ps(age, dt));
+    }
+#elif defined(PRESTO_PARTICLES_NEON)
+    float32x4_t dt = vdupq_n_f32(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t px = vld1q_f32(&system->positionX[i]);
+        float32x4_t py = vld1q_f32(&system->positionY[i]);
+        float32x4_t vx = vld1q_f32(&system->velocityX[i]);
+        float32x4_t vy = vld1q_f32(&system->velocityY[i]);
+        float32x4_t age = vld1q_f32(&system->age[i]);
+        vst1q_f32(&system->positionX[i], vmlaq_f32(px, vx, dt));
+        vst1q_f32(&system->positionY[i], vmlaq_f32(py, vy, dt));
+        vst1q_f32(&system->age[i], vaddq_f32(age, dt));
+    }
+#endif
+
+    // Scalar tail (or everything when no SIMD is available)
+    for (; i < count; i++) {
+        system->positionX[i] += system->velocityX[i] * deltaTime;
+        system->positionY[i] += system->velocityY[i] * deltaTime;
+        system->age[i] += deltaTime;
+    }
+}
+
 void Handler2D_UpdateParticles(ParticleSystem* system, float deltaTime) {
     if (!system) return;
-    
-    for (size_t i = 0; i < system->particleCount; i++) {
-        Particle* p = &system->particles[i];
-        
-        p->age += deltaTime;
-        
-        // Remove dead particles
-        if (p->age >= p->lifetime) {
-            // Swap with last particle and decrease count
-            system->particles[i] = system->particles[system->particleCount - 1];
-            system->particleCount--;
-            i--;
-            continue;
+
+    IntegrateParticles(system, deltaTime);
+
+    // Stable compaction: slide live particles down over dead ones, keeping order
+    size_t write = 0;
+    for (size_t read = 0; read < system->particleCount; read++) {
+        if (system->age[read] >= system->lifetime[read]) continue;
+        if (write != read) {
+            system->positionX[write] = system->positionX[read];
+            system->positionY[write] = system->positionY[read];
+            system->velocityX[write] = system->velocityX[read];
+            system->velocityY[write] = system->velocityY[read];
+            system->age[write] = system->age[read];
+            system->lifetime[write] = system->lifetime[read];
+            system->size[write] = system->size[read];
+            system->color[write] = system->color[read];
         }
-        
-        // Update particle
-        p->position.x += p->velocity.x * deltaTime;
-        p->position.y += p->velocity.y * deltaTime;
-        
-        // Fade out over lifetime
-        float alpha = 1.0f - (p->age / p->lifetime);
-        p->color.a = (unsigned char)(alpha * 255);
+        write++;
+    }
+    system->particleCount = write;
+}
+
+// Builds the round particle sprite on first use (needs a GL context)
+static void EnsureParticleTexture(ParticleSystem* system) {
+    if (system->texture.id != 0) return;
+
+    Image image = GenImageColor(PARTICLE_TEXTURE_SIZE, PARTICLE_TEXTURE_SIZE, BLANK);
+    ImageDrawCircle(&image, PARTICLE_TEXTURE_SIZE / 2, PARTICLE_TEXTURE_SIZE / 2, PARTICLE_TEXTURE_SIZE / 2, WHITE);
+    system->texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+}
+
+// Color with alpha faded out over the particle's lifetime
+static Color GetParticleColor(const ParticleSystem* system, size_t i) {
+    Color color = system->color[i];
+    float alpha = 1.0f - (system->age[i] / system->lifetime[i]);
+    if (alpha < 0.0f) alpha = 0.0f;
+    color.a = (unsigned char)(color.a * alpha);
+    return color;
+}
+
+void Handler2D_SubmitParticles(ParticleSystem* system, DrawQueue* queue, uint8_t layer) {
+    if (!system || !queue) return;
+    EnsureParticleTexture(system);
+
+    Rectangle source = { 0, 0, PARTICLE_TEXTURE_SIZE, PARTICLE_TEXTURE_SIZE };
+    for (size_t i = 0; i < system->particleCount; i++) {
+        float radius = system->size[i];
+        Rectangle dest = { system->positionX[i], system->positionY[i], radius * 2.0f, radius * 2.0f };
+        DrawQueue_Submit(queue, layer, 0, system->texture, source, dest, (Vector2){ radius, radius }, 0.0f,
+                         GetParticleColor(system, i));
     }
 }
 
 void Handler2D_RenderParticles(ParticleSystem* system) {
     if (!system) return;
-    
+    EnsureParticleTexture(system);
+
+    // Every quad uses the same texture, so raylib emits the system as one batch
+    Rectangle source = { 0, 0, PARTICLE_TEXTURE_SIZE, PARTICLE_TEXTURE_SIZE };
     for (size_t i = 0; i < system->particleCount; i++) {
-        Particle* p = &system->particles[i];
-        DrawCircleV(p->position, p->size, p->color);
+        float radius = system->size[i];
+        Rectangle dest = { system->positionX[i], system->positionY[i], radius * 2.0f, radius * 2.0f };
+        DrawTexturePro(system->texture, source, dest, (Vector2){ radius, radius }, 0.0f, GetParticleColor(system, i));
     }
 }
 
 void Handler2D_DestroyParticleSystem(ParticleSystem* system) {
     if (!system) return;
     
-    if (system->particles) {
-        free(system->particles);
+    if (system->texture.id != 0) {
+        UnloadTexture(system->texture);
     }
+    free(system->positionX); // Start of the shared array block
     free(system);
-}
\ No newline at end of file
+}
@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "visual-draw_queue.h"
 
 // Sprite instance for 2D rendering
 typedef struct {
@@ -15,6 +16,7 @@ typedef struct {
     Vector2 scale;
     Color tint;
     Rectangle sourceRect;  // For sprite sheets
+    int palette;           // Palette row for indexed textures, -1 for regular RGBA textures
 } SpriteInstance;
 
 // 2D Sprite handler
@@ -23,34 +25,65 @@ typedef struct {
     size_t spriteCount;
 } SpriteHandler;
 
+// Per-row horizontal deformation applied on top of the line scroll
+typedef enum {
+    BACKGROUND_DEFORM_NONE,
+    BACKGROUND_DEFORM_HEAT_HAZE,  // Short, fast ripple over the whole layer
+    BACKGROUND_DEFORM_WATER       // Long, slow wave below deformStartRow
+} BackgroundDeformType;
+
 // 2D Background/parallax layer
+// Each screen row gets its own horizontal offset (line scroll): the camera is
+// scaled by the factor of the texture row shown there, then the deformation
+// table is added. Rows are uploaded to offsetTexture and the layer is drawn as
+// a single quad.
 typedef struct {
     Texture2D texture;
     Vector2 position;
     Vector2 scrollSpeed;
     bool repeating;
+
+    Vector2 parallax;          // Camera factor for the whole layer (1 = moves with the camera)
+    float* rowParallax;        // Horizontal camera factor per texture row, NULL = parallax.x
+    BackgroundDeformType deformType;
+    float deformAmplitude;     // Pixels
+    float deformSpeed;         // Table entries per second
+    float deformPhase;
+    int deformStartRow;        // Screen rows above this are left alone (water line)
+    Texture2D offsetTexture;   // One float per screen row
 } BackgroundLayer;
 
 // 2D Background handler
 typedef struct {
     BackgroundLayer* layers;
     size_t layerCount;
+    Vector2 viewSize;          // Area covered by the layers, the virtual screen by default
+    float* rowOffsets;         // Scratch, one entry per screen row, grown with viewSize.y
+    int rowCapacity;
+    Shader lineScrollShader;
+    bool shaderReady;          // False: rows are drawn one by one on the CPU
+    int viewSizeLoc;
+    int textureSizeLoc;
+    int offsetYLoc;
+    int repeatingLoc;
+    int rowOffsetsLoc;
 } BackgroundHandler;
 
-// 2D particle system
-typedef struct {
-    Vector2 position;
-    Vector2 velocity;
-    Color color;
-    float lifetime;
-    float age;
-    float size;
-} Particle;
-
+// 2D particle system, stored as structure of arrays so the update kernel can
+// integrate four particles per SIMD instruction. Live particles are always the
+// first particleCount entries, kept in emission order.
 typedef struct {
-    Particle* particles;
+    float* positionX;
+    float* positionY;
+    float* velocityX;
+    float* velocityY;
+    float* age;
+    float* lifetime;
+    float* size;
+    Color* color;          // Base color, alpha fades out with age when rendered
     size_t particleCount;
     size_t maxParticles;
+    Texture2D texture;     // Round sprite shared by every quad so a system draws in one batch
 } ParticleSystem;
 
 // SpriteHandler functions
@@ -60,12 +93,18 @@ int Handler2D_AddSprite(SpriteHandler* handler, Texture2D texture, Vector2 posit
 int Handler2D_AddSpriteSheet(SpriteHandler* handler, Texture2D texture, Vector2 position,
                               Rectangle sourceRect, float rotation, Vector2 scale, Color tint);
 void Handler2D_UpdateSprite(SpriteHandler* handler, int index, Vector2 position, float rotation, Vector2 scale);
+void Handler2D_SetSpritePalette(SpriteHandler* handler, int index, int palette);
+void Handler2D_SubmitSprites(SpriteHandler* handler, DrawQueue* queue, uint8_t layer, Vector2 cameraOffset);
 void Handler2D_RenderSprites(SpriteHandler* handler, Vector2 cameraOffset);
 void Handler2D_DestroySpriteHandler(SpriteHandler* handler);
 
 // BackgroundHandler functions
 BackgroundHandler* Handler2D_CreateBackgroundHandler(void);
 int Handler2D_AddLayer(BackgroundHandler* handler, Texture2D texture, Vector2 scrollSpeed, bool repeating);
+void Handler2D_SetLayerParallax(BackgroundHandler* handler, int index, Vector2 parallax);
+void Handler2D_SetLayerParallaxBand(BackgroundHandler* handler, int index, int firstRow, int rowCount, float factor);
+void Handler2D_SetLayerDeformation(BackgroundHandler* handler, int index, BackgroundDeformType type,
+                                   float amplitude, float speed, int startRow);
 void Handler2D_UpdateBackground(BackgroundHandler* handler, float deltaTime);
 void Handler2D_RenderBackground(BackgroundHandler* handler, Vector2 cameraOffset);
 void Handler2D_DestroyBackgroundHandler(BackgroundHandler* handler);
@@ -75,5 +114,6 @@ ParticleSystem* Handler2D_CreateParticleSystem(size_t maxParticles);
 void Handler2D_EmitParticle(ParticleSystem* system, Vector2 position, Vector2 velocity, 
                             Color color, float lifetime, float size);
 void Handler2D_UpdateParticles(ParticleSystem* system, float deltaTime);
+void Handler2D_SubmitParticles(ParticleSystem* system, DrawQueue* queue, uint8_t layer);
 void Handler2D_RenderParticles(ParticleSystem* system);
 void Handler2D_DestroyParticleSystem(ParticleSystem* system);   
\ No newline at end of file
@@ -1,8 +1,12 @@
 // 3D Visual Handler implementation for Presto Framework Mini
 #include "visual-handler_3d.h"
+#include "visual-shaders.h"
+#include "visual-lighting.h"
+#include "visual-rlgl.h"
 #include "../util/util-math_utils.h"
 #include <string.h>
 #include <math.h>
+#include <float.h>
 
 // ===== Main 3D Handler =====
 
@@ -23,6 +27,7 @@ Handler3D* Handler3D_Create(void) {
     handler->camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
     handler->camera.fovy = 45.0f;
     handler->camera.projection = CAMERA_PERSPECTIVE;
+    handler->viewAspect = 0.0f;
     
     return handler;
 }
@@ -32,6 +37,18 @@ void Handler3D_SetCamera(Handler3D* handler, Camera3D camera) {
     handler->camera = camera;
 }
 
+void Handler3D_SetViewAspect(Handler3D* handler, float aspect) {
+    if (!handler) return;
+    handler->viewAspect = aspect;
+}
+
+// Same target BeginMode3D projects for: the render texture when one is bound
+static float GetViewAspect(const Handler3D* handler) {
+    if (handler->viewAspect > 0.0f) return handler->viewAspect;
+    int height = rlGetFramebufferHeight();
+    return (height > 0) ? (float)rlGetFramebufferWidth() / (float)height : 1.0f;
+}
+
 void Handler3D_Update(Handler3D* handler, float deltaTime) {
     if (!handler) return;
     
@@ -44,6 +61,12 @@ void Handler3D_Update(Handler3D* handler, float deltaTime) {
 void Handler3D_Render(Handler3D* handler) {
     if (!handler) return;
     
+    // Tile light lists follow the camera and the target being drawn to
+    if (handler->lightHandler) {
+        Lighting_BinLights(handler->lightHandler, handler->camera,
+                           rlGetFramebufferWidth(), rlGetFramebufferHeight());
+    }
+    
     BeginMode3D(handler->camera);
     
     // Render skybox first
@@ -53,12 +76,13 @@ void Handler3D_Render(Handler3D* handler) {
     
     // Render terrain
     if (handler->terrain) {
-        Handler3D_RenderTerrain(handler->terrain);
+        Handler3D_RenderTerrain(handler->terrain, handler->camera, GetViewAspect(handler));
     }
     
-    // Render models
+    // Render models, lit shaders read the light textures from fixed units
+    if (handler->lightHandler) Lighting_BindTextures(handler->lightHandler);
     if (handler->modelHandler) {
-        Handler3D_RenderModels(handler->modelHandler);
+        Handler3D_RenderModels(handler->modelHandler, handler->camera, GetViewAspect(handler));
     }
     
     // Render particle systems
@@ -103,13 +127,53 @@ void Handler3D_Destroy(Handler3D* handler) {
 ModelHandler* Handler3D_CreateModelHandler(void) {
     ModelHandler* handler = (ModelHandler*)malloc(sizeof(ModelHandler));
     if (!handler) return NULL;
+    memset(handler, 0, sizeof(ModelHandler));
     
     handler->models = NULL;
     handler->modelCount = 0;
+
+    handler->instancingShader = LoadInstancingShader();
+    handler->instancingReady = handler->instancingShader.locs[SHADER_LOC_MATRIX_MODEL] != -1;
+
+    // UnloadMaterial keeps the default shader and only frees the maps
+    Material defaultMaterial = LoadMaterialDefault();
+    handler->defaultShaderId = defaultMaterial.shader.id;
+    UnloadMaterial(defaultMaterial);
     
     return handler;
 }
 
+// Rebuilds the cached world matrix and bounding sphere of a dirty instance
+static void RefreshModelTransform(ModelInstance* instance) {
+    if (!instance->transformDirty) return;
+
+    Vector3 angles = Vector3Scale(instance->rotation, DEG2RAD);
+    Matrix world = MatrixMultiply(MatrixMultiply(MatrixScale(instance->scale.x, instance->scale.y, instance->scale.z),
+                                                 MatrixRotateXYZ(angles)),
+                                  MatrixTranslate(instance->position.x, instance->position.y, instance->position.z));
+    instance->transform = MatrixMultiply(instance->model.transform, world);
+
+    float maxScale = fmaxf(fabsf(instance->scale.x), fmaxf(fabsf(instance->scale.y), fabsf(instance->scale.z)));
+    instance->worldCenter = Vector3Transform(instance->localCenter, instance->transform);
+    instance->worldRadius = instance->localRadius * maxScale;
+
+    // World AABB from the eight transformed corners of the local box
+    BoundingBox local = instance->localBounds;
+    BoundingBox worldBox = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+    for (int c = 0; c < 8; c++) {
+        Vector3 corner = {
+            (c & 1) ? local.max.x : local.min.x,
+            (c & 2) ? local.max.y : local.min.y,
+            (c & 4) ? local.max.z : local.min.z
+        };
+        corner = Vector3Transform(corner, instance->transform);
+        worldBox.min = Vector3Min(worldBox.min, corner);
+        worldBox.max = Vector3Max(worldBox.max, corner);
+    }
+    instance->worldBounds = worldBox;
+    instance->transformDirty = false;
+}
+
 int Handler3D_AddModel(ModelHandler* handler, Model model, Vector3 position, 
                        Vector3 rotation, Vector3 scale, Color tint) {
     if (!handler) return -1;
@@ -119,14 +183,25 @@ int Handler3D_AddModel(ModelHandler* handler, Model model, Vector3 position,
     if (!newModels) return -1;
     
     handler->models = newModels;
-    handler->models[handler->modelCount].model = model;
-    handler->models[handler->modelCount].position = position;
-    handler->models[handler->modelCount].rotation = rotation;
-    handler->models[handler->modelCount].scale = scale;
-    handler->models[handler->modelCount].tint = tint;
-    handler->models[handler->modelCount].visible = true;
+    ModelInstance* instance = &handler->models[handler->modelCount];
+    instance->model = model;
+    instance->position = position;
+    instance->rotation = rotation;
+    instance->scale = scale;
+    instance->tint = tint;
+    instance->visible = true;
+
+    // Bounding sphere around the model-space box, computed once per instance
+    BoundingBox bounds = GetModelBoundingBox(model);
+    instance->localBounds = bounds;
+    instance->localCenter = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    instance->localRadius = Vector3Distance(bounds.min, bounds.max) * 0.5f;
+    instance->transformDirty = true;
+    instance->boundsDirty = false;
+    RefreshModelTransform(instance);
     
     handler->modelCount++;
+    handler->bvh.built = false;
     return handler->modelCount - 1;
 }
 
@@ -137,6 +212,9 @@ void Handler3D_UpdateModel(ModelHandler* handler, int index, Vector3 position,
     handler->models[index].position = position;
     handler->models[index].rotation = rotation;
     handler->models[index].scale = scale;
+    handler->models[index].transformDirty = true;
+    handler->models[index].boundsDirty = true;
+    handler->boundsDirty = true;
 }
 
 void Handler3D_SetModelVisibility(ModelHandler* handler, int index, bool visible) {
@@ -145,45 +223,95 @@ void Handler3D_SetModelVisibility(ModelHandler* handler, int index, bool visible
     handler->models[index].visible = visible;
 }
 
-void Handler3D_RenderModels(ModelHandler* handler) {
-    if (!handler) return;
-    
+static bool EnsureModelDrawCapacity(ModelHandler* handler) {
+    if (handler->drawCapacity >= handler->modelCount) return true;
+
+    size_t capacity = handler->modelCount + handler->modelCount / 2 + 16;
+    uint32_t* drawList = (uint32_t*)realloc(handler->drawList, sizeof(uint32_t) * capacity);
+    if (!drawList) return false;
+    handler->drawList = drawList;
+
+    Matrix* batch = (Matrix*)realloc(handler->batchTransforms, sizeof(Matrix) * capacity);
+    if (!batch) return false;
+    handler->batchTransforms = batch;
+
+    handler->drawCapacity = capacity;
+    return true;
+}
+
+// Instances share a Model when they point at the same mesh and material arrays
+static bool SameModel(const Model* a, const Model* b) {
+    return a->meshes == b->meshes && a->materials == b->materials;
+}
+
+static const ModelInstance* sortInstances = NULL;
+static int CompareInstanceModels(const void* a, const void* b) {
+    const Model* modelA = &sortInstances[*(const uint32_t*)a].model;
+    const Model* modelB = &sortInstances[*(const uint32_t*)b].model;
+    uintptr_t meshesA = (uintptr_t)modelA->meshes, meshesB = (uintptr_t)modelB->meshes;
+    if (meshesA != meshesB) return (meshesA > meshesB) - (meshesA < meshesB);
+    uintptr_t materialsA = (uintptr_t)modelA->materials, materialsB = (uintptr_t)modelB->materials;
+    return (materialsA > materialsB) - (materialsA < materialsB);
+}
+
+// The instancing shader only reproduces raylib's default shader, so models with
+// a custom (e.g. lit) shader keep drawing one DrawModel per instance
+static bool CanInstanceModel(const ModelHandler* handler, const Model* model) {
+    for (int m = 0; m < model->materialCount; m++) {
+        if (model->materials[m].shader.id != handler->defaultShaderId) return false;
+    }
+    return true;
+}
+
+void Handler3D_RenderModels(ModelHandler* handler, Camera3D camera, float aspect) {
+    if (!handler || handler->modelCount == 0) return;
+    if (!EnsureModelDrawCapacity(handler)) return;
+
+    // Refresh dirty transforms and cull against the view frustum
+    Frustum frustum = Handler3D_GetCameraFrustum(camera, aspect);
+    size_t visibleCount = 0;
     for (size_t i = 0; i < handler->modelCount; i++) {
-        ModelInstance* model = &handler->models[i];
-        
-        if (!model->visible) continue;
-        
-        // Create transformation matrix manually
-        Matrix transform = {
-            .m0 = 1.0f, .m4 = 0.0f, .m8 = 0.0f, .m12 = 0.0f,
-            .m1 = 0.0f, .m5 = 1.0f, .m9 = 0.0f, .m13 = 0.0f,
-            .m2 = 0.0f, .m6 = 0.0f, .m10 = 1.0f, .m14 = 0.0f,
-            .m3 = 0.0f, .m7 = 0.0f, .m11 = 0.0f, .m15 = 1.0f
-        };
-        // Apply scale
-        transform.m0 *= model->scale.x;
-        transform.m5 *= model->scale.y;
-        transform.m10 *= model->scale.z;
-
-        // Apply rotation (YZX order)
-        float radX = model->rotation.x * (PI / 180.0f);
-        float radY = model->rotation.y * (PI / 180.0f);
-        float radZ = model->rotation.z * (PI / 180.0f);
-        Matrix rotX = {
-            .m0 = 1, .m4 = 0, .m8 = 0, .m12 = 0,
-            .m1 = 0, .m5 = cosf(radX), .m9 = -sinf(radX), .m13 = 0,
-            .m2 = 0, .m6 = sinf(radX), .m10 = cosf(radX), .m14 = 0,
-            .m3 = 0, .m7 = 0, .m11 = 0, .m15 = 1
-        };
-        Matrix rotY = {
-            .m0 = cosf(radY), .m4 = 0, .m8 = sinf(radY), .m12 = 0,
-            .m1 = 0, .m5 = 1, .m9 = 0, .m13 = 0,
-            .m2 = -sinf(radY), .m6 = 0, .m10 = cosf(radY), .m14 = 0,
-            .m3 = 0, .m7 = 0, .m11 = 0, .m15 = 1
-        };
-        // Draw model with transformation
-        model->model.transform = transform;
-        DrawModel(model->model, (Vector3){0, 0, 0}, 1.0f, model->tint);
+        ModelInstance* instance = &handler->models[i];
+        if (!instance->visible) continue;
+
+        RefreshModelTransform(instance);
+        if (!Handler3D_IsSphereInFrustum(&frustum, instance->worldCenter, instance->worldRadius)) continue;
+        handler->drawList[visibleCount++] = (uint32_t)i;
+    }
+
+    // Group instances of the same Model next to each other
+    sortInstances = handler->models;
+    qsort(handler->drawList, visibleCount, sizeof(uint32_t), CompareInstanceModels);
+    sortInstances = NULL;
+
+    size_t start = 0;
+    while (start < visibleCount) {
+        const Model* model = &handler->models[handler->drawList[start]].model;
+        size_t end = start + 1;
+        while (end < visibleCount && SameModel(&handler->models[handler->drawList[end]].model, model)) end++;
+        size_t groupSize = end - start;
+
+        if (groupSize == 1 || !handler->instancingReady || !CanInstanceModel(handler, model)) {
+            // Draw with a copy so the shared Model's transform is never touched
+            for (size_t k = start; k < end; k++) {
+                const ModelInstance* instance = &handler->models[handler->drawList[k]];
+                Model drawn = instance->model;
+                drawn.transform = instance->transform;
+                DrawModel(drawn, (Vector3){0, 0, 0}, 1.0f, instance->tint);
+            }
+        } else {
+            // One instanced draw per mesh for the whole group
+            for (size_t k = start; k < end; k++) {
+                const ModelInstance* instance = &handler->models[handler->drawList[k]];
+                handler->batchTransforms[k - start] = PackInstanceTint(instance->transform, instance->tint);
+            }
+            for (int m = 0; m < model->meshCount; m++) {
+                Material material = model->materials[model->meshMaterial[m]];
+                material.shader = handler->instancingShader;
+                DrawMeshInstanced(model->meshes[m], material, handler->batchTransforms, (int)groupSize);
+            }
+        }
+        start = end;
     }
 }
 
@@ -193,9 +321,259 @@ void Handler3D_DestroyModelHandler(ModelHandler* handler) {
     if (handler->models) {
         free(handler->models);
     }
+    if (IsShaderValid(handler->instancingShader)) {
+        UnloadShader(handler->instancingShader);
+    }
+    free(handler->drawList);
+    free(handler->batchTransforms);
+    free(handler->bvh.nodes);
+    free(handler->bvh.items);
+    free(handler->bvh.leafOf);
     free(handler);
 }
 
+// ===== Model BVH =====
+
+#define MODEL_BVH_LEAF_SIZE 4
+#define MODEL_BVH_STACK_SIZE 64
+
+static BoundingBox MergeBounds(BoundingBox a, BoundingBox b) {
+    return (BoundingBox){ Vector3Min(a.min, b.min), Vector3Max(a.max, b.max) };
+}
+
+static float BoundsCentroidAxis(const BoundingBox* box, int axis) {
+    const float* mn = &box->min.x;
+    const float* mx = &box->max.x;
+    return (mn[axis] + mx[axis]) * 0.5f;
+}
+
+static int AllocBVHNode(ModelBVH* bvh) {
+    if (bvh->nodeCount >= bvh->nodeCapacity) {
+        int capacity = bvh->nodeCapacity ? bvh->nodeCapacity * 2 : 64;
+        ModelBVHNode* nodes = (ModelBVHNode*)realloc(bvh->nodes, sizeof(ModelBVHNode) * capacity);
+        if (!nodes) return -1;
+        bvh->nodes = nodes;
+        bvh->nodeCapacity = capacity;
+    }
+    return bvh->nodeCount++;
+}
+
+// Sort key for the median split below
+static const ModelInstance* bvhInstances = NULL;
+static int bvhAxis = 0;
+static int CompareBVHCentroids(const void* a, const void* b) {
+    float ca = BoundsCentroidAxis(&bvhInstances[*(const uint32_t*)a].worldBounds, bvhAxis);
+    float cb = BoundsCentroidAxis(&bvhInstances[*(const uint32_t*)b].worldBounds, bvhAxis);
+    return (ca > cb) - (ca < cb);
+}
+
+// Builds the subtree for items[first, first+count) and returns its node index
+static int BuildBVHNode(ModelBVH* bvh, const ModelInstance* instances, int first, int count, int parent) {
+    int index = AllocBVHNode(bvh);
+    if (index < 0) return -1;
+
+    BoundingBox bounds = instances[bvh->items[first]].worldBounds;
+    BoundingBox centroids = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+    for (int i = first; i < first + count; i++) {
+        const BoundingBox* box = &instances[bvh->items[i]].worldBounds;
+        Vector3 centre = Vector3Scale(Vector3Add(box->min, box->max), 0.5f);
+        bounds = MergeBounds(bounds, *box);
+        centroids.min = Vector3Min(centroids.min, centre);
+        centroids.max = Vector3Max(centroids.max, centre);
+    }
+
+    bvh->nodes[index] = (ModelBVHNode){ bounds, -1, -1, parent, first, count };
+    if (count <= MODEL_BVH_LEAF_SIZE) {
+        for (int i = first; i < first + count; i++) bvh->leafOf[bvh->items[i]] = index;
+        return index;
+    }
+
+    // Median split along the axis with the widest centroid spread
+    Vector3 extent = Vector3Subtract(centroids.max, centroids.min);
+    bvhAxis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+    bvhInstances = instances;
+    qsort(&bvh->items[first], count, sizeof(uint32_t), CompareBVHCentroids);
+
+    int half = count / 2;
+    int left = BuildBVHNode(bvh, instances, first, half, index);
+    int right = BuildBVHNode(bvh, instances, first + half, count - half, index);
+    if (left < 0 || right < 0) return -1;
+
+    // nodes may have moved during the recursive allocations
+    bvh->nodes[index].left = left;
+    bvh->nodes[index].right = right;
+    bvh->nodes[index].count = 0;
+    return index;
+}
+
+void Handler3D_BuildModelBVH(ModelHandler* handler) {
+    if (!handler) return;
+    ModelBVH* bvh = &handler->bvh;
+    bvh->built = false;
+    bvh->nodeCount = 0;
+    bvh->itemCount = 0;
+    if (handler->modelCount == 0) return;
+
+    uint32_t* items = (uint32_t*)realloc(bvh->items, sizeof(uint32_t) * handler->modelCount);
+    if (!items) return;
+    bvh->items = items;
+    int* leafOf = (int*)realloc(bvh->leafOf, sizeof(int) * handler->modelCount);
+    if (!leafOf) return;
+    bvh->leafOf = leafOf;
+
+    for (size_t i = 0; i < handler->modelCount; i++) {
+        RefreshModelTransform(&handler->models[i]);
+        handler->models[i].boundsDirty = false;
+        bvh->items[i] = (uint32_t)i;
+    }
+    bvh->itemCount = handler->modelCount;
+
+    if (BuildBVHNode(bvh, handler->models, 0, (int)bvh->itemCount, -1) < 0) {
+        printf("Failed to allocate model BVH\n");
+        return;
+    }
+    bvh->built = true;
+    handler->boundsDirty = false;
+}
+
+void Handler3D_RefitModelBVH(ModelHandler* handler) {
+    if (!handler) return;
+    if (!handler->bvh.built || handler->bvh.itemCount != handler->modelCount) {
+        Handler3D_BuildModelBVH(handler);
+        return;
+    }
+    if (!handler->boundsDirty) return;
+
+    ModelBVH* bvh = &handler->bvh;
+    for (size_t i = 0; i < handler->modelCount; i++) {
+        ModelInstance* instance = &handler->models[i];
+        if (!instance->boundsDirty) continue;
+        RefreshModelTransform(instance);
+        instance->boundsDirty = false;
+
+        // Recompute the leaf, then walk up until a node's bounds stop changing
+        int node = bvh->leafOf[i];
+        ModelBVHNode* leaf = &bvh->nodes[node];
+        BoundingBox bounds = handler->models[bvh->items[leaf->first]].worldBounds;
+        for (int k = leaf->first + 1; k < leaf->first + leaf->count; k++) {
+            bounds = MergeBounds(bounds, handler->models[bvh->items[k]].worldBounds);
+        }
+        leaf->bounds = bounds;
+
+        for (node = leaf->parent; node >= 0; node = bvh->nodes[node].parent) {
+            ModelBVHNode* current = &bvh->nodes[node];
+            BoundingBox merged = MergeBounds(bvh->nodes[current->left].bounds, bvh->nodes[current->right].bounds);
+            if (memcmp(&merged, &current->bounds, sizeof(BoundingBox)) == 0) break;
+            current->bounds = merged;
+        }
+    }
+    handler->boundsDirty = false;
+}
+
+// Slab test against a node box; returns the entry distance or FLT_MAX on a miss
+static float IntersectBVHBounds(const BoundingBox* box, Vector3 origin, Vector3 invDir, float maxDistance) {
+    float t1 = (box->min.x - origin.x) * invDir.x;
+    float t2 = (box->max.x - origin.x) * invDir.x;
+    float tmin = fminf(t1, t2), tmax = fmaxf(t1, t2);
+    t1 = (box->min.y - origin.y) * invDir.y;
+    t2 = (box->max.y - origin.y) * invDir.y;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+    t1 = (box->min.z - origin.z) * invDir.z;
+    t2 = (box->max.z - origin.z) * invDir.z;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    if (tmax < fmaxf(tmin, 0.0f) || tmin > maxDistance) return FLT_MAX;
+    return fmaxf(tmin, 0.0f);
+}
+
+static RayCollision RaycastModelInstance(const ModelInstance* instance, Ray ray, bool meshPrecise) {
+    RayCollision collision = GetRayCollisionBox(ray, instance->worldBounds);
+    if (!collision.hit || !meshPrecise) return collision;
+
+    RayCollision nearest = { 0 };
+    nearest.distance = FLT_MAX;
+    for (int m = 0; m < instance->model.meshCount; m++) {
+        RayCollision meshHit = GetRayCollisionMesh(ray, instance->model.meshes[m], instance->transform);
+        if (meshHit.hit && meshHit.distance < nearest.distance) nearest = meshHit;
+    }
+    return nearest;
+}
+
+static ModelRayHit RaycastModelBVH(const ModelHandler* handler, Ray ray, float maxDistance, bool meshPrecise) {
+    ModelRayHit result = { false, -1, maxDistance, { 0, 0, 0 }, { 0, 0, 0 } };
+    const ModelBVH* bvh = &handler->bvh;
+    if (!bvh->built || bvh->nodeCount == 0) return result;
+
+    Vector3 invDir = {
+        1.0f / ray.direction.x,
+        1.0f / ray.direction.y,
+        1.0f / ray.direction.z
+    };
+
+    int stack[MODEL_BVH_STACK_SIZE];
+    int top = 0;
+    if (IntersectBVHBounds(&bvh->nodes[0].bounds, ray.position, invDir, maxDistance) == FLT_MAX) return result;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const ModelBVHNode* node = &bvh->nodes[stack[--top]];
+
+        if (node->left < 0) {
+            for (int k = node->first; k < node->first + node->count; k++) {
+                const ModelInstance* instance = &handler->models[bvh->items[k]];
+                if (!instance->visible) continue;
+
+                RayCollision collision = RaycastModelInstance(instance, ray, meshPrecise);
+                if (collision.hit && collision.distance <= result.distance) {
+                    result.hit = true;
+                    result.instance = (int)bvh->items[k];
+                    result.distance = collision.distance;
+                    result.point = collision.point;
+                    result.normal = collision.normal;
+                }
+            }
+            continue;
+        }
+
+        // Visit the nearer child first so distant subtrees get rejected by the current hit
+        float tLeft = IntersectBVHBounds(&bvh->nodes[node->left].bounds, ray.position, invDir, result.distance);
+        float tRight = IntersectBVHBounds(&bvh->nodes[node->right].bounds, ray.position, invDir, result.distance);
+        int nearChild = node->left, farChild = node->right;
+        if (tRight < tLeft) {
+            float t = tLeft; tLeft = tRight; tRight = t;
+            nearChild = node->right; farChild = node->left;
+        }
+        if (tRight != FLT_MAX && top < MODEL_BVH_STACK_SIZE) stack[top++] = farChild;
+        if (tLeft != FLT_MAX && top < MODEL_BVH_STACK_SIZE) stack[top++] = nearChild;
+    }
+
+    if (!result.hit) result.distance = maxDistance;
+    return result;
+}
+
+ModelRayHit Handler3D_RaycastModels(ModelHandler* handler, Ray ray, float maxDistance, bool meshPrecise) {
+    ModelRayHit result = { false, -1, 0.0f, { 0, 0, 0 }, { 0, 0, 0 } };
+    if (!handler) return result;
+    if (maxDistance <= 0.0f) maxDistance = FLT_MAX;
+
+    Handler3D_RefitModelBVH(handler);
+    return RaycastModelBVH(handler, ray, maxDistance, meshPrecise);
+}
+
+void Handler3D_RaycastModelsBatch(ModelHandler* handler, const Ray* rays, size_t rayCount,
+                                  float maxDistance, bool meshPrecise, ModelRayHit* hits) {
+    if (!handler || !rays || !hits) return;
+    if (maxDistance <= 0.0f) maxDistance = FLT_MAX;
+
+    // Refit once for the whole batch
+    Handler3D_RefitModelBVH(handler);
+    for (size_t i = 0; i < rayCount; i++) {
+        hits[i] = RaycastModelBVH(handler, rays[i], maxDistance, meshPrecise);
+    }
+}
+
 // ===== Light Handler =====
 
 LightHandler* Handler3D_CreateLightHandler(void) {
@@ -206,6 +584,12 @@ LightHandler* Handler3D_CreateLightHandler(void) {
     handler->lightCount = 0;
     handler->ambientColor = (Vector3){ 0.2f, 0.2f, 0.2f };
     handler->ambientIntensity = 1.0f;
+    handler->lightsDirty = false;
+    handler->lightTexture = (Texture2D){ 0 };
+    handler->tileTexture = (Texture2D){ 0 };
+    handler->tileData = NULL;
+    handler->tilesX = 0;
+    handler->tilesY = 0;
     
     return handler;
 }
@@ -219,6 +603,7 @@ int Handler3D_AddDirectionalLight(LightHandler* handler, Vector3 direction,
     if (!newLights) return -1;
     
     handler->lights = newLights;
+    memset(&handler->lights[handler->lightCount], 0, sizeof(LightInstance));
     handler->lights[handler->lightCount].type = LIGHT_DIRECTIONAL;
     handler->lights[handler->lightCount].position = (Vector3){0, 0, 0};
     Vector3 normDir = Vector3Normalize(direction);
@@ -226,6 +611,8 @@ int Handler3D_AddDirectionalLight(LightHandler* handler, Vector3 direction,
     handler->lights[handler->lightCount].color = color;
     handler->lights[handler->lightCount].intensity = intensity;
     handler->lights[handler->lightCount].enabled = true;
+    handler->lights[handler->lightCount].dirty = true;
+    handler->lightsDirty = true;
     
     handler->lightCount++;
     return handler->lightCount - 1;
@@ -240,6 +627,7 @@ int Handler3D_AddPointLight(LightHandler* handler, Vector3 position,
     if (!newLights) return -1;
     
     handler->lights = newLights;
+    memset(&handler->lights[handler->lightCount], 0, sizeof(LightInstance));
     handler->lights[handler->lightCount].type = LIGHT_POINT;
     handler->lights[handler->lightCount].position = position;
     handler->lights[handler->lightCount].direction = (Vector3){0, 0, 0};
@@ -247,6 +635,8 @@ int Handler3D_AddPointLight(LightHandler* handler, Vector3 position,
     handler->lights[handler->lightCount].intensity = intensity;
     handler->lights[handler->lightCount].range = range;
     handler->lights[handler->lightCount].enabled = true;
+    handler->lights[handler->lightCount].dirty = true;
+    handler->lightsDirty = true;
     
     handler->lightCount++;
     return handler->lightCount - 1;
@@ -262,6 +652,7 @@ int Handler3D_AddSpotLight(LightHandler* handler, Vector3 position, Vector3 dire
     if (!newLights) return -1;
     
     handler->lights = newLights;
+    memset(&handler->lights[handler->lightCount], 0, sizeof(LightInstance));
     handler->lights[handler->lightCount].type = LIGHT_SPOT;
     handler->lights[handler->lightCount].position = position;
     Vector3 normDir = Vector3Normalize(direction);
@@ -272,6 +663,8 @@ int Handler3D_AddSpotLight(LightHandler* handler, Vector3 position, Vector3 dire
     handler->lights[handler->lightCount].innerCone = innerCone;
     handler->lights[handler->lightCount].outerCone = outerCone;
     handler->lights[handler->lightCount].enabled = true;
+    handler->lights[handler->lightCount].dirty = true;
+    handler->lightsDirty = true;
     
     handler->lightCount++;
     return handler->lightCount - 1;
@@ -286,12 +679,17 @@ void Handler3D_UpdateLight(LightHandler* handler, int index, Vector3 position,
     handler->lights[index].direction = normDir;
     handler->lights[index].color = color;
     handler->lights[index].intensity = intensity;
+    handler->lights[index].dirty = true;
+    handler->lightsDirty = true;
 }
 
 void Handler3D_SetLightEnabled(LightHandler* handler, int index, bool enabled) {
     if (!handler || index < 0 || index >= handler->lightCount) return;
     
+    if (handler->lights[index].enabled == enabled) return;
     handler->lights[index].enabled = enabled;
+    handler->lights[index].dirty = true;
+    handler->lightsDirty = true;
 }
 
 void Handler3D_SetAmbientLight(LightHandler* handler, Vector3 color, float intensity) {
@@ -304,25 +702,14 @@ void Handler3D_SetAmbientLight(LightHandler* handler, Vector3 color, float inten
 void Handler3D_ApplyLighting(LightHandler* handler, Shader shader) {
     if (!handler) return;
     
-    // Apply ambient lighting
-    int ambientLoc = GetShaderLocation(shader, "ambientColor");
-    if (ambientLoc != -1) {
-        Vector3 ambient = Vector3Scale(handler->ambientColor, handler->ambientIntensity);
-        SetShaderValue(shader, ambientLoc, &ambient, SHADER_UNIFORM_VEC3);
-    }
-    
-    // Apply lights (simplified - would need proper shader implementation)
-    for (size_t i = 0; i < handler->lightCount && i < 8; i++) {
-        if (!handler->lights[i].enabled) continue;
-        
-        // This would require a proper lighting shader setup
-        // For now, just set basic light properties
-    }
+    // Cached locations, dirty lights only; see visual-lighting
+    Lighting_Apply(handler, shader);
 }
 
 void Handler3D_DestroyLightHandler(LightHandler* handler) {
     if (!handler) return;
     
+    Lighting_Unload(handler);
     if (handler->lights) {
         free(handler->lights);
     }
@@ -331,12 +718,78 @@ void Handler3D_DestroyLightHandler(LightHandler* handler) {
 
 // ===== Particle System 3D =====
 
+#define PARTICLE3D_TEXTURE_SIZE 32
+
+// Unit quad in the XY plane, centered on the origin
+static Mesh GenParticleQuadMesh(void) {
+    Mesh mesh = { 0 };
+    mesh.vertexCount = 4;
+    mesh.triangleCount = 2;
+    mesh.vertices = (float*)MemAlloc(4 * 3 * sizeof(float));
+    mesh.texcoords = (float*)MemAlloc(4 * 2 * sizeof(float));
+    mesh.normals = (float*)MemAlloc(4 * 3 * sizeof(float));
+    mesh.indices = (unsigned short*)MemAlloc(6 * sizeof(unsigned short));
+
+    const float vertices[12] = { -0.5f, -0.5f, 0.0f,   0.5f, -0.5f, 0.0f,   0.5f, 0.5f, 0.0f,   -0.5f, 0.5f, 0.0f };
+    const float texcoords[8] = { 0.0f, 1.0f,   1.0f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f };
+    const unsigned short indices[6] = { 0, 1, 2, 0, 2, 3 };
+    memcpy(mesh.vertices, vertices, sizeof(vertices));
+    memcpy(mesh.texcoords, texcoords, sizeof(texcoords));
+    memcpy(mesh.indices, indices, sizeof(indices));
+    for (int i = 0; i < 4; i++) {
+        mesh.normals[i * 3 + 0] = 0.0f;
+        mesh.normals[i * 3 + 1] = 0.0f;
+        mesh.normals[i * 3 + 2] = 1.0f;
+    }
+
+    UploadMesh(&mesh, false);
+    return mesh;
+}
+
+// Stable LSD radix sort producing the ascending order of `keys` in `order`
+static void RadixSortKeys(const uint32_t* keys, uint32_t* order, uint32_t* scratch, size_t count) {
+    uint32_t* src = order;
+    uint32_t* dst = scratch;
+    for (size_t i = 0; i < count; i++) src[i] = (uint32_t)i;
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        size_t histogram[256] = { 0 };
+        for (size_t i = 0; i < count; i++) histogram[(keys[i] >> shift) & 0xFF]++;
+
+        size_t offset = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t n = histogram[b];
+            histogram[b] = offset;
+            offset += n;
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint32_t index = src[i];
+            dst[histogram[(keys[index] >> shift) & 0xFF]++] = index;
+        }
+
+        uint32_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+    // Four passes: the result is back in `order`
+}
+
 ParticleSystem3D* Handler3D_CreateParticleSystem3D(size_t maxParticles, bool billboard) {
     ParticleSystem3D* system = (ParticleSystem3D*)malloc(sizeof(ParticleSystem3D));
     if (!system) return NULL;
+    memset(system, 0, sizeof(ParticleSystem3D));
     
     system->particles = (Particle3D*)malloc(sizeof(Particle3D) * maxParticles);
-    if (!system->particles) {
+    system->transforms = (Matrix*)malloc(sizeof(Matrix) * maxParticles);
+    system->sortKeys = (uint32_t*)malloc(sizeof(uint32_t) * maxParticles);
+    system->sortOrder = (uint32_t*)malloc(sizeof(uint32_t) * maxParticles);
+    system->sortScratch = (uint32_t*)malloc(sizeof(uint32_t) * maxParticles);
+    if (!system->particles || !system->transforms || !system->sortKeys || !system->sortOrder || !system->sortScratch) {
+        free(system->particles);
+        free(system->transforms);
+        free(system->sortKeys);
+        free(system->sortOrder);
+        free(system->sortScratch);
         free(system);
         return NULL;
     }
@@ -345,6 +798,26 @@ ParticleSystem3D* Handler3D_CreateParticleSystem3D(size_t maxParticles, bool bil
     system->maxParticles = maxParticles;
     system->emitterPosition = (Vector3){0, 0, 0};
     system->billboard = billboard;
+    system->alphaBlend = billboard;
+
+    // Shared geometry and material for the instanced draw
+    system->mesh = billboard ? GenParticleQuadMesh() : GenMeshCube(1.0f, 1.0f, 1.0f);
+    system->material = LoadMaterialDefault();
+    Shader shader = LoadInstancingShader();
+    system->instanced = shader.locs[SHADER_LOC_MATRIX_MODEL] != -1;
+    if (system->instanced) {
+        system->material.shader = shader;
+    } else {
+        UnloadShader(shader);
+    }
+
+    if (billboard) {
+        // Round sprite so billboards aren't drawn as squares
+        Image image = GenImageColor(PARTICLE3D_TEXTURE_SIZE, PARTICLE3D_TEXTURE_SIZE, BLANK);
+        ImageDrawCircle(&image, PARTICLE3D_TEXTURE_SIZE / 2, PARTICLE3D_TEXTURE_SIZE / 2, PARTICLE3D_TEXTURE_SIZE / 2, WHITE);
+        system->material.maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
     
     return system;
 }
@@ -395,27 +868,84 @@ void Handler3D_UpdateParticles3D(ParticleSystem3D* system, float deltaTime) {
 }
 
 void Handler3D_RenderParticles3D(ParticleSystem3D* system, Camera3D camera) {
-    if (!system) return;
+    if (!system || system->particleCount == 0) return;
     
-    for (size_t i = 0; i < system->particleCount; i++) {
-        Particle3D* p = &system->particles[i];
-        
+    size_t count = system->particleCount;
+    Texture2D texture = system->material.maps[MATERIAL_MAP_DIFFUSE].texture;
+
+    if (!system->instanced) {
+        // Immediate-mode fallback when instancing isn't available
+        for (size_t i = 0; i < count; i++) {
+            Particle3D* p = &system->particles[i];
+            if (system->billboard) {
+                DrawBillboard(camera, texture, p->position, p->size, p->color);
+            } else {
+                DrawCube(p->position, p->size, p->size, p->size, p->color);
+            }
+        }
+        return;
+    }
+
+    // Back-to-front order for blended particles. Squared distances are positive
+    // floats, so their bit patterns sort like integers; inverting them makes the
+    // ascending radix sort yield the farthest particle first.
+    const uint32_t* order = NULL;
+    if (system->alphaBlend) {
+        for (size_t i = 0; i < count; i++) {
+            float distance = Vector3DistanceSqr(system->particles[i].position, camera.position);
+            uint32_t bits;
+            memcpy(&bits, &distance, sizeof(bits));
+            system->sortKeys[i] = ~bits;
+        }
+        RadixSortKeys(system->sortKeys, system->sortOrder, system->sortScratch, count);
+        order = system->sortOrder;
+    }
+
+    // Camera basis from the view matrix rows
+    Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Vector3 right = { view.m0, view.m4, view.m8 };
+    Vector3 up = { view.m1, view.m5, view.m9 };
+    Vector3 forward = { view.m2, view.m6, view.m10 };
+
+    for (size_t k = 0; k < count; k++) {
+        const Particle3D* p = &system->particles[order ? order[k] : k];
+        Matrix transform = { 0 };
+
         if (system->billboard) {
-            // Billboard particles always face camera
-            DrawBillboard(camera, (Texture2D){0}, p->position, p->size, p->color);
+            // Quad facing the camera, spun around the view axis by p->rotation (degrees)
+            float c = cosf(p->rotation * DEG2RAD);
+            float s = sinf(p->rotation * DEG2RAD);
+            Vector3 axisX = Vector3Scale(Vector3Add(Vector3Scale(right, c), Vector3Scale(up, s)), p->size);
+            Vector3 axisY = Vector3Scale(Vector3Subtract(Vector3Scale(up, c), Vector3Scale(right, s)), p->size);
+            Vector3 axisZ = Vector3Scale(forward, p->size);
+            transform.m0 = axisX.x; transform.m1 = axisX.y; transform.m2 = axisX.z;
+            transform.m4 = axisY.x; transform.m5 = axisY.y; transform.m6 = axisY.z;
+            transform.m8 = axisZ.x; transform.m9 = axisZ.y; transform.m10 = axisZ.z;
         } else {
-            // Draw as 3D cube or sphere
-            DrawCube(p->position, p->size, p->size, p->size, p->color);
+            transform.m0 = p->size;
+            transform.m5 = p->size;
+            transform.m10 = p->size;
         }
+        transform.m12 = p->position.x;
+        transform.m13 = p->position.y;
+        transform.m14 = p->position.z;
+
+        system->transforms[k] = PackInstanceTint(transform, p->color);
     }
+
+    DrawMeshInstanced(system->mesh, system->material, system->transforms, (int)count);
 }
 
 void Handler3D_DestroyParticleSystem3D(ParticleSystem3D* system) {
     if (!system) return;
     
-    if (system->particles) {
-        free(system->particles);
-    }
+    UnloadMesh(system->mesh);
+    UnloadMaterial(system->material); // Also unloads the instancing shader and sprite texture
+    free(system->particles);
+    free(system->transforms);
+    free(system->sortKeys);
+    free(system->sortOrder);
+    free(system->sortScratch);
     free(system);
 }
 
@@ -453,31 +983,209 @@ void Handler3D_DestroySkybox(Skybox* skybox) {
 
 // ===== Terrain =====
 
+static inline float TerrainSample(const Terrain* terrain, int x, int z) {
+    return terrain->heights[z * terrain->width + x];
+}
+
+// Grid index of the k-th vertex walking a chunk's edge: +X along the first
+// row, +Z down the last column, then back along the last row and first column
+static int TerrainPerimeterVertex(int k, int countX, int countZ) {
+    if (k < countX - 1) return k;
+    k -= countX - 1;
+    if (k < countZ - 1) return k * countX + (countX - 1);
+    k -= countZ - 1;
+    if (k < countX - 1) return (countZ - 1) * countX + (countX - 1 - k);
+    k -= countX - 1;
+    return (countZ - 1 - k) * countX;
+}
+
+// Builds one LOD of a chunk: a grid sampled every `step` cells plus a skirt
+// hanging below the outer edge
+static Mesh GenTerrainChunkMesh(const Terrain* terrain, int startX, int startZ, int cellsX, int cellsZ, int step) {
+    Mesh mesh = { 0 };
+    int countX = (cellsX + step - 1) / step + 1;
+    int countZ = (cellsZ + step - 1) / step + 1;
+    int gridVertices = countX * countZ;
+    int perimeter = 2 * (countX - 1) + 2 * (countZ - 1);
+
+    mesh.vertexCount = gridVertices + perimeter;
+    mesh.triangleCount = 2 * (countX - 1) * (countZ - 1) + 2 * perimeter;
+    mesh.vertices = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.texcoords = (float*)MemAlloc(mesh.vertexCount * 2 * sizeof(float));
+    mesh.normals = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.indices = (unsigned short*)MemAlloc(mesh.triangleCount * 3 * sizeof(unsigned short));
+
+    float invWidth = 1.0f / (float)(terrain->width - 1);
+    float invDepth = 1.0f / (float)(terrain->depth - 1);
+    int v = 0;
+    for (int j = 0; j < countZ; j++) {
+        int z = startZ + ((j * step < cellsZ) ? j * step : cellsZ);
+        for (int i = 0; i < countX; i++) {
+            int x = startX + ((i * step < cellsX) ? i * step : cellsX);
+
+            // Central differences over the full-resolution samples
+            float left = TerrainSample(terrain, (x > 0) ? x - 1 : x, z);
+            float right = TerrainSample(terrain, (x < terrain->width - 1) ? x + 1 : x, z);
+            float up = TerrainSample(terrain, x, (z > 0) ? z - 1 : z);
+            float down = TerrainSample(terrain, x, (z < terrain->depth - 1) ? z + 1 : z);
+            Vector3 normal = Vector3Normalize((Vector3){ left - right, 2.0f, up - down });
+
+            mesh.vertices[v * 3 + 0] = (float)x;
+            mesh.vertices[v * 3 + 1] = TerrainSample(terrain, x, z);
+            mesh.vertices[v * 3 + 2] = (float)z;
+            mesh.normals[v * 3 + 0] = normal.x;
+            mesh.normals[v * 3 + 1] = normal.y;
+            mesh.normals[v * 3 + 2] = normal.z;
+            mesh.texcoords[v * 2 + 0] = (float)x * invWidth;
+            mesh.texcoords[v * 2 + 1] = (float)z * invDepth;
+            v++;
+        }
+    }
+
+    int t = 0;
+    for (int j = 0; j < countZ - 1; j++) {
+        for (int i = 0; i < countX - 1; i++) {
+            unsigned short a = (unsigned short)(j * countX + i);
+            unsigned short c = (unsigned short)(a + 1);
+            unsigned short b = (unsigned short)(a + countX);
+            unsigned short d = (unsigned short)(b + 1);
+            mesh.indices[t++] = a; mesh.indices[t++] = b; mesh.indices[t++] = c;
+            mesh.indices[t++] = c; mesh.indices[t++] = b; mesh.indices[t++] = d;
+        }
+    }
+
+    // Skirt: walk the perimeter so every quad faces outwards, duplicating
+    // each edge vertex below the surface
+    float skirtDepth = terrain->maxHeight * 0.1f + 1.0f;
+    for (int k = 0; k < perimeter; k++) {
+        int top = TerrainPerimeterVertex(k, countX, countZ);
+        memcpy(&mesh.vertices[v * 3], &mesh.vertices[top * 3], 3 * sizeof(float));
+        memcpy(&mesh.normals[v * 3], &mesh.normals[top * 3], 3 * sizeof(float));
+        memcpy(&mesh.texcoords[v * 2], &mesh.texcoords[top * 2], 2 * sizeof(float));
+        mesh.vertices[v * 3 + 1] -= skirtDepth;
+        v++;
+    }
+    for (int k = 0; k < perimeter; k++) {
+        int next = (k + 1) % perimeter;
+        unsigned short top0 = (unsigned short)TerrainPerimeterVertex(k, countX, countZ);
+        unsigned short top1 = (unsigned short)TerrainPerimeterVertex(next, countX, countZ);
+        unsigned short bottom0 = (unsigned short)(gridVertices + k);
+        unsigned short bottom1 = (unsigned short)(gridVertices + next);
+        mesh.indices[t++] = top0; mesh.indices[t++] = top1; mesh.indices[t++] = bottom0;
+        mesh.indices[t++] = top1; mesh.indices[t++] = bottom1; mesh.indices[t++] = bottom0;
+    }
+    UploadMesh(&mesh, false);
+    return mesh;
+}
+
 Terrain* Handler3D_CreateTerrain(Texture2D heightmap, Vector3 position, Vector3 scale, 
                                 float maxHeight, Texture2D texture) {
     Terrain* terrain = (Terrain*)malloc(sizeof(Terrain));
     if (!terrain) return NULL;
-    
-    // Generate terrain mesh from heightmap
-    terrain->mesh = GenMeshHeightmap(LoadImageFromTexture(heightmap), (Vector3){heightmap.width, maxHeight, heightmap.height});
-    terrain->model = LoadModelFromMesh(terrain->mesh);
+    memset(terrain, 0, sizeof(Terrain));
+
     terrain->position = position;
     terrain->scale = scale;
     terrain->heightmap = heightmap;
     terrain->texture = texture;
     terrain->maxHeight = maxHeight;
-    
+    terrain->width = heightmap.width;
+    terrain->depth = heightmap.height;
+
+    if (terrain->width < 2 || terrain->depth < 2) {
+        printf("Terrain heightmap too small: %dx%d\n", terrain->width, terrain->depth);
+        free(terrain);
+        return NULL;
+    }
+
+    // Keep the heights on the CPU (same grey-level mapping as GenMeshHeightmap)
+    Image image = LoadImageFromTexture(heightmap);
+    Color* pixels = LoadImageColors(image);
+    UnloadImage(image);
+    terrain->heights = (float*)malloc(sizeof(float) * terrain->width * terrain->depth);
+    if (!pixels || !terrain->heights) {
+        UnloadImageColors(pixels);
+        free(terrain->heights);
+        free(terrain);
+        return NULL;
+    }
+    for (int i = 0; i < terrain->width * terrain->depth; i++) {
+        float grey = (pixels[i].r + pixels[i].g + pixels[i].b) / 3.0f;
+        terrain->heights[i] = grey / 255.0f * maxHeight;
+    }
+    UnloadImageColors(pixels);
+
+    // Chunk meshes, all LODs built up front
+    int cellsX = terrain->width - 1;
+    int cellsZ = terrain->depth - 1;
+    terrain->chunksX = (cellsX + TERRAIN_CHUNK_CELLS - 1) / TERRAIN_CHUNK_CELLS;
+    terrain->chunksZ = (cellsZ + TERRAIN_CHUNK_CELLS - 1) / TERRAIN_CHUNK_CELLS;
+    terrain->chunks = (TerrainChunk*)malloc(sizeof(TerrainChunk) * terrain->chunksX * terrain->chunksZ);
+    if (!terrain->chunks) {
+        free(terrain->heights);
+        free(terrain);
+        return NULL;
+    }
+
+    terrain->transform = MatrixMultiply(MatrixScale(scale.x, scale.y, scale.z),
+                                        MatrixTranslate(position.x, position.y, position.z));
+    float skirtDepth = maxHeight * 0.1f + 1.0f;
+
+    for (int cz = 0; cz < terrain->chunksZ; cz++) {
+        for (int cx = 0; cx < terrain->chunksX; cx++) {
+            TerrainChunk* chunk = &terrain->chunks[cz * terrain->chunksX + cx];
+            int startX = cx * TERRAIN_CHUNK_CELLS;
+            int startZ = cz * TERRAIN_CHUNK_CELLS;
+            int sizeX = (cellsX - startX < TERRAIN_CHUNK_CELLS) ? cellsX - startX : TERRAIN_CHUNK_CELLS;
+            int sizeZ = (cellsZ - startZ < TERRAIN_CHUNK_CELLS) ? cellsZ - startZ : TERRAIN_CHUNK_CELLS;
+
+            for (int lod = 0; lod < TERRAIN_LOD_COUNT; lod++) {
+                chunk->lods[lod] = GenTerrainChunkMesh(terrain, startX, startZ, sizeX, sizeZ, 1 << lod);
+            }
+
+            float chunkMin = maxHeight, chunkMax = 0.0f;
+            for (int z = startZ; z <= startZ + sizeZ; z++) {
+                for (int x = startX; x <= startX + sizeX; x++) {
+                    float h = TerrainSample(terrain, x, z);
+                    chunkMin = fminf(chunkMin, h);
+                    chunkMax = fmaxf(chunkMax, h);
+                }
+            }
+
+            Vector3 localMin = { (float)startX, chunkMin - skirtDepth, (float)startZ };
+            Vector3 localMax = { (float)(startX + sizeX), chunkMax, (float)(startZ + sizeZ) };
+            Vector3 worldA = Vector3Transform(localMin, terrain->transform);
+            Vector3 worldB = Vector3Transform(localMax, terrain->transform);
+            chunk->bounds = (BoundingBox){ Vector3Min(worldA, worldB), Vector3Max(worldA, worldB) };
+            chunk->center = Vector3Scale(Vector3Add(chunk->bounds.min, chunk->bounds.max), 0.5f);
+        }
+    }
+
+    terrain->lodDistance = 2.0f * TERRAIN_CHUNK_CELLS * fmaxf(fabsf(scale.x), fabsf(scale.z));
+
     // Set terrain texture
-    terrain->model.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = texture;
+    terrain->material = LoadMaterialDefault();
+    terrain->material.maps[MATERIAL_MAP_DIFFUSE].texture = texture;
     
     return terrain;
 }
 
-void Handler3D_RenderTerrain(Terrain* terrain) {
+void Handler3D_RenderTerrain(Terrain* terrain, Camera3D camera, float aspect) {
     if (!terrain) return;
-    
-    // Apply transformation and draw
-    DrawModelEx(terrain->model, terrain->position, (Vector3){1, 0, 0}, 0.0f, terrain->scale, WHITE);
+
+    Frustum frustum = Handler3D_GetCameraFrustum(camera, aspect);
+    int chunkCount = terrain->chunksX * terrain->chunksZ;
+    for (int i = 0; i < chunkCount; i++) {
+        const TerrainChunk* chunk = &terrain->chunks[i];
+        if (!Handler3D_IsBoxInFrustum(&frustum, chunk->bounds)) continue;
+
+        // Every lodDistance further away halves the grid density
+        float distance = Vector3Distance(camera.position, chunk->center);
+        int lod = (int)(distance / terrain->lodDistance);
+        if (lod >= TERRAIN_LOD_COUNT) lod = TERRAIN_LOD_COUNT - 1;
+
+        DrawMesh(chunk->lods[lod], terrain->material, terrain->transform);
+    }
 }
 
 float Handler3D_GetTerrainHeight(Terrain* terrain, float x, float z) {
@@ -487,21 +1195,37 @@ float Handler3D_GetTerrainHeight(Terrain* terrain, float x, float z) {
     float mapX = (x - terrain->position.x) / terrain->scale.x;
     float mapZ = (z - terrain->position.z) / terrain->scale.z;
     
-    // Sample heightmap (simplified - would need proper interpolation)
-    if (mapX >= 0 && mapX < terrain->heightmap.width && 
-        mapZ >= 0 && mapZ < terrain->heightmap.height) {
-        
-        // This is a simplified version - real implementation would sample the heightmap texture
-        return terrain->position.y;
+    if (mapX < 0.0f || mapX > (float)(terrain->width - 1) ||
+        mapZ < 0.0f || mapZ > (float)(terrain->depth - 1)) {
+        return 0.0f;
     }
-    
-    return 0.0f;
+
+    // Bilinear interpolation between the four surrounding samples
+    int x0 = (int)mapX;
+    int z0 = (int)mapZ;
+    int x1 = (x0 < terrain->width - 1) ? x0 + 1 : x0;
+    int z1 = (z0 < terrain->depth - 1) ? z0 + 1 : z0;
+    float fx = mapX - (float)x0;
+    float fz = mapZ - (float)z0;
+
+    float top = Lerp(TerrainSample(terrain, x0, z0), TerrainSample(terrain, x1, z0), fx);
+    float bottom = Lerp(TerrainSample(terrain, x0, z1), TerrainSample(terrain, x1, z1), fx);
+    return terrain->position.y + Lerp(top, bottom, fz) * terrain->scale.y;
 }
 
 void Handler3D_DestroyTerrain(Terrain* terrain) {
     if (!terrain) return;
     
-    UnloadModel(terrain->model);
+    int chunkCount = terrain->chunksX * terrain->chunksZ;
+    for (int i = 0; i < chunkCount; i++) {
+        for (int lod = 0; lod < TERRAIN_LOD_COUNT; lod++) {
+            UnloadMesh(terrain->chunks[i].lods[lod]);
+        }
+    }
+    // The texture and default shader belong to the caller/raylib, only free the maps
+    RL_FREE(terrain->material.maps);
+    free(terrain->chunks);
+    free(terrain->heights);
     free(terrain);
 }
 
@@ -515,6 +1239,66 @@ Vector2 Handler3D_WorldToScreen(Vector3 worldPos, Camera3D camera) {
     return GetWorldToScreen(worldPos, camera);
 }
 
+Frustum Handler3D_GetCameraFrustum(Camera3D camera, float aspect) {
+    // Same near/far distances as raylib's BeginMode3D
+    const double nearPlane = 0.01;
+    const double farPlane = 1000.0;
+
+    Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Matrix projection;
+    if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+        double top = camera.fovy / 2.0;
+        double right = top * aspect;
+        projection = MatrixOrtho(-right, right, -top, top, nearPlane, farPlane);
+    } else {
+        projection = MatrixPerspective(camera.fovy * DEG2RAD, aspect, nearPlane, farPlane);
+    }
+    Matrix clip = MatrixMultiply(view, projection);
+
+    // Gribb-Hartmann: planes are sums/differences of the clip matrix rows
+    Vector4 row0 = { clip.m0, clip.m4, clip.m8, clip.m12 };
+    Vector4 row1 = { clip.m1, clip.m5, clip.m9, clip.m13 };
+    Vector4 row2 = { clip.m2, clip.m6, clip.m10, clip.m14 };
+    Vector4 row3 = { clip.m3, clip.m7, clip.m11, clip.m15 };
+
+    Frustum frustum;
+    frustum.planes[0] = Vector4Add(row3, row0);      // Left
+    frustum.planes[1] = Vector4Subtract(row3, row0); // Right
+    frustum.planes[2] = Vector4Add(row3, row1);      // Bottom
+    frustum.planes[3] = Vector4Subtract(row3, row1); // Top
+    frustum.planes[4] = Vector4Add(row3, row2);      // Near
+    frustum.planes[5] = Vector4Subtract(row3, row2); // Far
+
+    for (int i = 0; i < 6; i++) {
+        Vector4 p = frustum.planes[i];
+        float length = sqrtf(p.x * p.x + p.y * p.y + p.z * p.z);
+        if (length > 0.0f) frustum.planes[i] = Vector4Scale(p, 1.0f / length);
+    }
+    return frustum;
+}
+
+bool Handler3D_IsSphereInFrustum(const Frustum* frustum, Vector3 center, float radius) {
+    for (int i = 0; i < 6; i++) {
+        Vector4 p = frustum->planes[i];
+        if (p.x * center.x + p.y * center.y + p.z * center.z + p.w < -radius) return false;
+    }
+    return true;
+}
+
+bool Handler3D_IsBoxInFrustum(const Frustum* frustum, BoundingBox box) {
+    for (int i = 0; i < 6; i++) {
+        Vector4 p = frustum->planes[i];
+        // Corner furthest along the plane normal
+        Vector3 v = {
+            (p.x >= 0.0f) ? box.max.x : box.min.x,
+            (p.y >= 0.0f) ? box.max.y : box.min.y,
+            (p.z >= 0.0f) ? box.max.z : box.min.z
+        };
+        if (p.x * v.x + p.y * v.y + p.z * v.z + p.w < 0.0f) return false;
+    }
+    return true;
+}
+
 bool Handler3D_CheckRayCollision(Vector3 rayOrigin, Vector3 rayDirection, Vector3 boxMin, Vector3 boxMax) {
     BoundingBox box = {boxMin, boxMax};
     Ray ray = {rayOrigin, rayDirection};
@@ -5,23 +5,79 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 // 3D Model instance for rendering
 typedef struct {
     Model model;
     Vector3 position;
-    Vector3 rotation;
+    Vector3 rotation;    // Euler angles in degrees
     Vector3 scale;
     Color tint;
     bool visible;
+
+    Matrix transform;    // Cached world matrix (model.transform * scale * rotation * translation)
+    bool transformDirty; // Set by Handler3D_UpdateModel, cleared when the matrix is rebuilt
+    Vector3 localCenter; // Bounding sphere in model space
+    float localRadius;
+    Vector3 worldCenter; // Bounding sphere in world space, refreshed with the transform
+    float worldRadius;
+    BoundingBox localBounds;
+    BoundingBox worldBounds; // Axis-aligned box around the transformed local box
+    bool boundsDirty;        // Moved since the BVH was last refit
 } ModelInstance;
 
+// BVH node over model instance bounds. Children always follow their parent in
+// the node array; leaves reference a range of ModelBVH.items.
+typedef struct {
+    BoundingBox bounds;
+    int left;   // -1 for leaves
+    int right;
+    int parent; // -1 for the root
+    int first;  // Leaves only
+    int count;
+} ModelBVHNode;
+
+typedef struct {
+    ModelBVHNode* nodes;
+    int nodeCount;
+    int nodeCapacity;
+    uint32_t* items;  // Instance indices, grouped per leaf
+    int* leafOf;      // Leaf node of each instance
+    size_t itemCount;
+    bool built;
+} ModelBVH;
+
+// Result of a BVH ray query
+typedef struct {
+    bool hit;
+    int instance;     // Index into ModelHandler.models, -1 when nothing was hit
+    float distance;
+    Vector3 point;
+    Vector3 normal;
+} ModelRayHit;
+
 // 3D Model handler
 typedef struct {
     ModelInstance* models;
     size_t modelCount;
+
+    Shader instancingShader;  // Used for groups of instances sharing a Model
+    bool instancingReady;
+    unsigned int defaultShaderId; // Only models on raylib's default shader are instanced
+    uint32_t* drawList;       // Visible instance indices, grouped by Model
+    Matrix* batchTransforms;  // Instance buffer for one group
+    size_t drawCapacity;
+
+    ModelBVH bvh;             // Rebuilt when instances are added, refit when they move
+    bool boundsDirty;         // Any instance has boundsDirty set
 } ModelHandler;
 
+// View frustum planes (xyz = normal pointing inside, w = distance)
+typedef struct {
+    Vector4 planes[6];
+} Frustum;
+
 // 3D Light types
 typedef enum {
     LIGHT_DIRECTIONAL,
@@ -40,6 +96,7 @@ typedef struct {
     float innerCone;  // For spot lights
     float outerCone;  // For spot lights
     bool enabled;
+    bool dirty;       // Changed since the last Lighting_UploadLights
 } LightInstance;
 
 // 3D Lighting handler
@@ -48,6 +105,14 @@ typedef struct {
     size_t lightCount;
     Vector3 ambientColor;
     float ambientIntensity;
+
+    // GPU-side state owned by visual-lighting
+    bool lightsDirty;       // Any light has dirty set
+    Texture2D lightTexture; // Packed light rows
+    Texture2D tileTexture;  // Per-tile light lists
+    float* tileData;
+    int tilesX;
+    int tilesY;
 } LightHandler;
 
 // 3D Particle for particle system
@@ -64,12 +129,24 @@ typedef struct {
 } Particle3D;
 
 // 3D Particle system
+// Every particle of a system is drawn with one DrawMeshInstanced call. Position,
+// size and rotation go into a per-instance transform and the color into that
+// matrix's unused bottom row (see LoadInstancingShader).
 typedef struct {
     Particle3D* particles;
     size_t particleCount;
     size_t maxParticles;
     Vector3 emitterPosition;
     bool billboard;  // Face camera
+    bool alphaBlend; // Sort back to front before drawing (on for billboards by default)
+
+    Mesh mesh;           // Unit quad for billboards, unit cube otherwise
+    Material material;   // Instancing shader + particle texture
+    bool instanced;      // False when the instancing shader is unavailable
+    Matrix* transforms;  // Instance buffer, rebuilt every frame
+    uint32_t* sortKeys;
+    uint32_t* sortOrder;
+    uint32_t* sortScratch;
 } ParticleSystem3D;
 
 // 3D Skybox
@@ -80,14 +157,34 @@ typedef struct {
 } Skybox;
 
 // 3D Terrain/Heightmap
+// One heightmap pixel is one unit before `scale`. The mesh is split into
+// TERRAIN_CHUNK_CELLS-wide chunks, each with TERRAIN_LOD_COUNT meshes of
+// decreasing density and a skirt hiding cracks between neighbouring LODs.
+#define TERRAIN_CHUNK_CELLS 32
+#define TERRAIN_LOD_COUNT 3
+
+typedef struct {
+    Mesh lods[TERRAIN_LOD_COUNT];
+    BoundingBox bounds;  // World space
+    Vector3 center;
+} TerrainChunk;
+
 typedef struct {
-    Mesh mesh;
-    Model model;
     Vector3 position;
     Vector3 scale;
     Texture2D heightmap;
     Texture2D texture;
     float maxHeight;
+
+    float* heights;      // width * depth samples, local units (0..maxHeight)
+    int width;
+    int depth;
+    TerrainChunk* chunks;
+    int chunksX;
+    int chunksZ;
+    Material material;
+    Matrix transform;
+    float lodDistance;   // World distance at which chunks drop to the next LOD
 } Terrain;
 
 // Main 3D Handler
@@ -99,11 +196,13 @@ typedef struct {
     Skybox* skybox;
     Terrain* terrain;
     Camera3D camera;
+    float viewAspect; // Width / height of the render target, 0 = the bound framebuffer
 } Handler3D;
 
 // Main 3D Handler functions
 Handler3D* Handler3D_Create(void);
 void Handler3D_SetCamera(Handler3D* handler, Camera3D camera);
+void Handler3D_SetViewAspect(Handler3D* handler, float aspect);
 void Handler3D_Update(Handler3D* handler, float deltaTime);
 void Handler3D_Render(Handler3D* handler);
 void Handler3D_Destroy(Handler3D* handler);
@@ -115,9 +214,16 @@ int Handler3D_AddModel(ModelHandler* handler, Model model, Vector3 position,
 void Handler3D_UpdateModel(ModelHandler* handler, int index, Vector3 position, 
                           Vector3 rotation, Vector3 scale);
 void Handler3D_SetModelVisibility(ModelHandler* handler, int index, bool visible);
-void Handler3D_RenderModels(ModelHandler* handler);
+void Handler3D_RenderModels(ModelHandler* handler, Camera3D camera, float aspect);
 void Handler3D_DestroyModelHandler(ModelHandler* handler);
 
+// Model BVH functions (queries build/refit on demand)
+void Handler3D_BuildModelBVH(ModelHandler* handler);
+void Handler3D_RefitModelBVH(ModelHandler* handler);
+ModelRayHit Handler3D_RaycastModels(ModelHandler* handler, Ray ray, float maxDistance, bool meshPrecise);
+void Handler3D_RaycastModelsBatch(ModelHandler* handler, const Ray* rays, size_t rayCount,
+                                  float maxDistance, bool meshPrecise, ModelRayHit* hits);
+
 // Light Handler functions
 LightHandler* Handler3D_CreateLightHandler(void);
 int Handler3D_AddDirectionalLight(LightHandler* handler, Vector3 direction, 
@@ -131,6 +237,8 @@ void Handler3D_UpdateLight(LightHandler* handler, int index, Vector3 position,
                           Vector3 direction, Color color, float intensity);
 void Handler3D_SetLightEnabled(LightHandler* handler, int index, bool enabled);
 void Handler3D_SetAmbientLight(LightHandler* handler, Vector3 color, float intensity);
+// Tile lists are built by Handler3D_Render (or Lighting_BinLights); until one
+// has run, only the ambient term and the light rows are bound
 void Handler3D_ApplyLighting(LightHandler* handler, Shader shader);
 void Handler3D_DestroyLightHandler(LightHandler* handler);
 
@@ -150,11 +258,14 @@ void Handler3D_DestroySkybox(Skybox* skybox);
 // Terrain functions
 Terrain* Handler3D_CreateTerrain(Texture2D heightmap, Vector3 position, Vector3 scale, 
                                 float maxHeight, Texture2D texture);
-void Handler3D_RenderTerrain(Terrain* terrain);
+void Handler3D_RenderTerrain(Terrain* terrain, Camera3D camera, float aspect);
 float Handler3D_GetTerrainHeight(Terrain* terrain, float x, float z);
 void Handler3D_DestroyTerrain(Terrain* terrain);
 
 // Utility functions
 Vector3 Handler3D_ScreenToWorld(Vector2 screenPos, Camera3D camera);
 Vector2 Handler3D_WorldToScreen(Vector3 worldPos, Camera3D camera);
+Frustum Handler3D_GetCameraFrustum(Camera3D camera, float aspect);
+bool Handler3D_IsSphereInFrustum(const Frustum* frustum, Vector3 center, float radius);
+bool Handler3D_IsBoxInFrustum(const Frustum* frustum, BoundingBox box);
 bool Handler3D_CheckRayCollision(Vector3 rayOrigin, Vector3 rayDirection, Vector3 boxMin, Vector3 boxMax);
\ No newline at end of file
@@ -0,0 +1,398 @@
+// Forward+ lighting implementation for Presto Framework Mini
+#include "visual-lighting.h"
+#include "visual-shaders.h"
+#include "visual-rlgl.h"
+#include "raymath.h"
+#include <string.h>
+#include <math.h>
+
+#define LIGHTING_STRINGIFY_(x) #x
+#define LIGHTING_STRINGIFY(x) LIGHTING_STRINGIFY_(x)
+
+// Slice 0 of the tile texture holds the light count, the rest the indices.
+// Each slice is a tilesX x tilesY block stacked vertically, so the texture
+// stays tilesX wide (within GLES2 size limits even at 1080p).
+#define LIGHTING_TILE_ROWS (LIGHTING_MAX_LIGHTS_PER_TILE + 1)
+
+static LightShaderLocations shaderLocations[LIGHTING_MAX_SHADERS];
+static int shaderLocationCount = 0;
+
+static const char* forwardPlusVS =
+    "ATTRIBUTE vec3 vertexPosition;\n"
+    "ATTRIBUTE vec2 vertexTexCoord;\n"
+    "ATTRIBUTE vec3 vertexNormal;\n"
+    "ATTRIBUTE vec4 vertexColor;\n"
+    "uniform mat4 mvp;\n"
+    "uniform mat4 matModel;\n"
+    "uniform mat4 matNormal;\n"
+    "VARYING vec3 fragPosition;\n"
+    "VARYING vec3 fragNormal;\n"
+    "VARYING vec2 fragTexCoord;\n"
+    "VARYING vec4 fragColor;\n"
+    "void main() {\n"
+    "    fragPosition = vec3(matModel * vec4(vertexPosition, 1.0));\n"
+    "    fragNormal = normalize(vec3(matNormal * vec4(vertexNormal, 0.0)));\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragColor = vertexColor;\n"
+    "    gl_Position = mvp * vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char* forwardPlusFS =
+    "#define MAX_LIGHTS " LIGHTING_STRINGIFY(LIGHTING_MAX_LIGHTS) ".0\n"
+    "#define MAX_PER_TILE " LIGHTING_STRINGIFY(LIGHTING_MAX_LIGHTS_PER_TILE) "\n"
+    "#define TILE_ROWS " LIGHTING_STRINGIFY(LIGHTING_TILE_ROWS) ".0\n"
+    "VARYING vec3 fragPosition;\n"
+    "VARYING vec3 fragNormal;\n"
+    "VARYING vec2 fragTexCoord;\n"
+    "VARYING vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform sampler2D lightData;\n"
+    "uniform sampler2D tileData;\n"
+    "uniform vec3 ambientColor;\n"
+    "uniform vec2 tileGrid;\n"
+    "uniform float tileSize;\n"
+    "vec4 FetchLight(float index, float texel) {\n"
+    "    return TEXTURE(lightData, vec2((texel + 0.5) / 4.0, (index + 0.5) / MAX_LIGHTS));\n"
+    "}\n"
+    "void main() {\n"
+    "    vec4 base = TEXTURE(texture0, fragTexCoord) * colDiffuse * fragColor;\n"
+    "    vec3 normal = normalize(fragNormal);\n"
+    "    vec2 tile = min(floor(gl_FragCoord.xy / tileSize), tileGrid - 1.0);\n"
+    "    float tileU = (tile.x + 0.5) / tileGrid.x;\n"
+    "    float sliceV = 1.0 / TILE_ROWS;\n"
+    "    float tileV = (tile.y + 0.5) / (tileGrid.y * TILE_ROWS);\n"
+    "    float count = TEXTURE(tileData, vec2(tileU, tileV)).r;\n"
+    "    vec3 lit = ambientColor;\n"
+    "    for (int i = 0; i < MAX_PER_TILE; i++) {\n"
+    "        if (float(i) >= count) break;\n"
+    "        float index = TEXTURE(tileData, vec2(tileU, tileV + (float(i) + 1.0) * sliceV)).r;\n"
+    "        vec4 positionRange = FetchLight(index, 0.0);\n"
+    "        vec4 directionType = FetchLight(index, 1.0);\n"
+    "        vec4 colorIntensity = FetchLight(index, 2.0);\n"
+    "        vec4 cone = FetchLight(index, 3.0);\n"
+    "        vec3 toLight = -directionType.xyz;\n"
+    "        float attenuation = 1.0;\n"
+    "        if (directionType.w > 0.5) {\n"
+    "            vec3 offset = positionRange.xyz - fragPosition;\n"
+    "            float dist = length(offset);\n"
+    "            toLight = offset / max(dist, 0.0001);\n"
+    "            attenuation = clamp(1.0 - dist / positionRange.w, 0.0, 1.0);\n"
+    "            attenuation *= attenuation;\n"
+    "            if (directionType.w > 1.5) {\n"
+    "                attenuation *= smoothstep(cone.y, cone.x, dot(-toLight, directionType.xyz));\n"
+    "            }\n"
+    "        }\n"
+    "        lit += colorIntensity.rgb * colorIntensity.a * attenuation * max(dot(normal, toLight), 0.0);\n"
+    "    }\n"
+    "    FRAG_COLOR = vec4(base.rgb * lit, base.a);\n"
+    "}\n";
+
+const LightShaderLocations* Lighting_GetShaderLocations(Shader shader) {
+    for (int i = 0; i < shaderLocationCount; i++) {
+        if (shaderLocations[i].shaderId == shader.id && shaderLocations[i].shaderLocs == shader.locs) {
+            return &shaderLocations[i];
+        }
+    }
+
+    // Table full: recycle the oldest slot, shaders are rarely swapped that often
+    int slot = shaderLocationCount;
+    if (slot >= LIGHTING_MAX_SHADERS) {
+        memmove(&shaderLocations[0], &shaderLocations[1], sizeof(LightShaderLocations) * (LIGHTING_MAX_SHADERS - 1));
+        slot = LIGHTING_MAX_SHADERS - 1;
+    } else {
+        shaderLocationCount++;
+    }
+
+    LightShaderLocations* locs = &shaderLocations[slot];
+    locs->shaderId = shader.id;
+    locs->shaderLocs = shader.locs;
+    locs->ambientColor = GetShaderLocation(shader, "ambientColor");
+    locs->lightData = GetShaderLocation(shader, "lightData");
+    locs->tileData = GetShaderLocation(shader, "tileData");
+    locs->tileGrid = GetShaderLocation(shader, "tileGrid");
+    locs->tileSize = GetShaderLocation(shader, "tileSize");
+    return locs;
+}
+
+void Lighting_ForgetShader(Shader shader) {
+    for (int i = 0; i < shaderLocationCount; i++) {
+        if (shaderLocations[i].shaderId != shader.id) continue;
+
+        memmove(&shaderLocations[i], &shaderLocations[i + 1],
+                sizeof(LightShaderLocations) * (size_t)(shaderLocationCount - i - 1));
+        shaderLocationCount--;
+        return;
+    }
+}
+
+Shader Lighting_LoadForwardPlusShader(void) {
+    Shader shader = LoadPortableShader(forwardPlusVS, forwardPlusFS);
+    if (!IsPortableShaderReady(shader, "lightData")) {
+        printf("Warning: Forward+ lighting shader failed to compile\n");
+    }
+    return shader;
+}
+
+static void PackLight(const LightInstance* light, float* row) {
+    row[0] = light->position.x;
+    row[1] = light->position.y;
+    row[2] = light->position.z;
+    row[3] = light->range;
+    row[4] = light->direction.x;
+    row[5] = light->direction.y;
+    row[6] = light->direction.z;
+    row[7] = (float)light->type;
+    float enabled = light->enabled ? 1.0f : 0.0f;
+    row[8] = light->color.r / 255.0f;
+    row[9] = light->color.g / 255.0f;
+    row[10] = light->color.b / 255.0f;
+    row[11] = light->intensity * enabled;
+    row[12] = cosf(light->innerCone * DEG2RAD);
+    row[13] = cosf(light->outerCone * DEG2RAD);
+    row[14] = enabled;
+    row[15] = 0.0f;
+}
+
+static bool EnsureLightTexture(LightHandler* handler) {
+    if (handler->lightTexture.id != 0) return true;
+
+    float* zero = (float*)calloc(LIGHTING_MAX_LIGHTS * LIGHTING_TEXELS_PER_LIGHT * 4, sizeof(float));
+    if (!zero) return false;
+    Image image = {
+        .data = zero,
+        .width = LIGHTING_TEXELS_PER_LIGHT,
+        .height = LIGHTING_MAX_LIGHTS,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+    };
+    handler->lightTexture = LoadTextureFromImage(image);
+    free(zero);
+    if (handler->lightTexture.id == 0) return false;
+
+    SetTextureFilter(handler->lightTexture, TEXTURE_FILTER_POINT);
+    return true;
+}
+
+void Lighting_UploadLights(LightHandler* handler) {
+    if (!handler || !handler->lightsDirty) return;
+    if (!EnsureLightTexture(handler)) return;
+
+    // Lights past LIGHTING_MAX_LIGHTS are kept on the CPU but never shaded
+    size_t count = (handler->lightCount < LIGHTING_MAX_LIGHTS) ? handler->lightCount : LIGHTING_MAX_LIGHTS;
+    float rows[LIGHTING_MAX_LIGHTS * LIGHTING_TEXELS_PER_LIGHT * 4];
+
+    // Send each contiguous run of dirty lights as one sub-rectangle
+    size_t i = 0;
+    while (i < count) {
+        if (!handler->lights[i].dirty) { i++; continue; }
+
+        size_t start = i;
+        while (i < count && handler->lights[i].dirty) {
+            PackLight(&handler->lights[i], &rows[(i - start) * LIGHTING_TEXELS_PER_LIGHT * 4]);
+            handler->lights[i].dirty = false;
+            i++;
+        }
+        Rectangle rec = { 0, (float)start, LIGHTING_TEXELS_PER_LIGHT, (float)(i - start) };
+        UpdateTextureRec(handler->lightTexture, rec, rows);
+    }
+    handler->lightsDirty = false;
+}
+
+static bool EnsureTileTexture(LightHandler* handler, int tilesX, int tilesY) {
+    if (handler->tileTexture.id != 0 && handler->tilesX == tilesX && handler->tilesY == tilesY) return true;
+
+    if (handler->tileTexture.id != 0) UnloadTexture(handler->tileTexture);
+    handler->tileTexture = (Texture2D){ 0 };
+
+    size_t size = (size_t)tilesX * tilesY * LIGHTING_TILE_ROWS;
+    float* tileData = (float*)realloc(handler->tileData, sizeof(float) * size);
+    if (!tileData) return false;
+    handler->tileData = tileData;
+    memset(tileData, 0, sizeof(float) * size);
+
+    Image image = {
+        .data = tileData,
+        .width = tilesX,
+        .height = tilesY * LIGHTING_TILE_ROWS,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R32
+    };
+    handler->tileTexture = LoadTextureFromImage(image);
+    if (handler->tileTexture.id == 0) return false;
+
+    SetTextureFilter(handler->tileTexture, TEXTURE_FILTER_POINT);
+    handler->tilesX = tilesX;
+    handler->tilesY = tilesY;
+    return true;
+}
+
+static void AddLightToTiles(LightHandler* handler, int lightIndex, int minX, int minY, int maxX, int maxY) {
+    int tileCount = handler->tilesX * handler->tilesY;
+    for (int ty = minY; ty <= maxY; ty++) {
+        for (int tx = minX; tx <= maxX; tx++) {
+            int tile = ty * handler->tilesX + tx;
+            float* count = &handler->tileData[tile];
+            if (*count >= LIGHTING_MAX_LIGHTS_PER_TILE) continue;
+
+            handler->tileData[(size_t)(1 + (int)*count) * tileCount + tile] = (float)lightIndex;
+            *count += 1.0f;
+        }
+    }
+}
+
+void Lighting_BinLights(LightHandler* handler, Camera3D camera, int width, int height) {
+    if (!handler || width <= 0 || height <= 0) return;
+
+    int tilesX = (width + LIGHTING_TILE_SIZE - 1) / LIGHTING_TILE_SIZE;
+    int tilesY = (height + LIGHTING_TILE_SIZE - 1) / LIGHTING_TILE_SIZE;
+    if (!EnsureTileTexture(handler, tilesX, tilesY)) return;
+
+    int tileCount = tilesX * tilesY;
+    memset(handler->tileData, 0, sizeof(float) * tileCount);
+
+    // Same projection as Handler3D_GetCameraFrustum
+    const float nearPlane = 0.01f;
+    bool perspective = camera.projection != CAMERA_ORTHOGRAPHIC;
+    float aspect = (float)width / (float)height;
+    Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Matrix projection = perspective
+        ? MatrixPerspective(camera.fovy * DEG2RAD, aspect, nearPlane, 1000.0)
+        : MatrixOrtho(-camera.fovy * 0.5 * aspect, camera.fovy * 0.5 * aspect,
+                      -camera.fovy * 0.5, camera.fovy * 0.5, nearPlane, 1000.0);
+
+    size_t count = (handler->lightCount < LIGHTING_MAX_LIGHTS) ? handler->lightCount : LIGHTING_MAX_LIGHTS;
+    for (size_t i = 0; i < count; i++) {
+        const LightInstance* light = &handler->lights[i];
+        if (!light->enabled) continue;
+
+        if (light->type == LIGHT_DIRECTIONAL) {
+            AddLightToTiles(handler, (int)i, 0, 0, tilesX - 1, tilesY - 1);
+            continue;
+        }
+
+        // Bound the light's sphere of influence on screen
+        Vector3 v = Vector3Transform(light->position, view);
+        float depth = -v.z;
+        if (depth + light->range < nearPlane) continue;
+
+        if (perspective && depth - light->range < nearPlane) {
+            // Camera inside or touching the sphere: it can reach any tile
+            AddLightToTiles(handler, (int)i, 0, 0, tilesX - 1, tilesY - 1);
+            continue;
+        }
+
+        float w = perspective ? depth : 1.0f;
+        float wNear = perspective ? depth - light->range : 1.0f;
+        float ndcX = (projection.m0 * v.x + projection.m8 * v.z + projection.m12) / w;
+        float ndcY = (projection.m5 * v.y + projection.m9 * v.z + projection.m13) / w;
+        float radiusX = light->range * projection.m0 / wNear;
+        float radiusY = light->range * projection.m5 / wNear;
+
+        // gl_FragCoord is bottom-up, so tile rows are too
+        int minX = (int)floorf((ndcX - radiusX + 1.0f) * 0.5f * width / LIGHTING_TILE_SIZE);
+        int maxX = (int)floorf((ndcX + radiusX + 1.0f) * 0.5f * width / LIGHTING_TILE_SIZE);
+        int minY = (int)floorf((ndcY - radiusY + 1.0f) * 0.5f * height / LIGHTING_TILE_SIZE);
+        int maxY = (int)floorf((ndcY + radiusY + 1.0f) * 0.5f * height / LIGHTING_TILE_SIZE);
+        if (maxX < 0 || maxY < 0 || minX >= tilesX || minY >= tilesY) continue;
+
+        if (minX < 0) minX = 0;
+        if (minY < 0) minY = 0;
+        if (maxX >= tilesX) maxX = tilesX - 1;
+        if (maxY >= tilesY) maxY = tilesY - 1;
+        AddLightToTiles(handler, (int)i, minX, minY, maxX, maxY);
+    }
+
+    UpdateTexture(handler->tileTexture, handler->tileData);
+}
+
+void Lighting_Apply(LightHandler* handler, Shader shader) {
+    if (!handler) return;
+    const LightShaderLocations* locs = Lighting_GetShaderLocations(shader);
+
+    if (locs->ambientColor != -1) {
+        Vector3 ambient = Vector3Scale(handler->ambientColor, handler->ambientIntensity);
+        SetShaderValue(shader, locs->ambientColor, &ambient, SHADER_UNIFORM_VEC3);
+    }
+
+    Lighting_UploadLights(handler);
+    if (handler->lightTexture.id == 0) return;
+    Lighting_BindTextures(handler);
+
+    // Samplers take the texture unit, not the texture
+    if (locs->lightData != -1) {
+        int unit = LIGHTING_LIGHT_TEXTURE_UNIT;
+        SetShaderValue(shader, locs->lightData, &unit, SHADER_UNIFORM_INT);
+    }
+
+    if (handler->tileTexture.id == 0) {
+        static bool warned = false;
+        if (!warned) {
+            printf("Lighting applied before any Lighting_BinLights, dynamic lights are skipped\n");
+            warned = true;
+        }
+        return;
+    }
+
+    if (locs->tileData != -1) {
+        int unit = LIGHTING_TILE_TEXTURE_UNIT;
+        SetShaderValue(shader, locs->tileData, &unit, SHADER_UNIFORM_INT);
+    }
+    if (locs->tileGrid != -1) {
+        Vector2 grid = { (float)handler->tilesX, (float)handler->tilesY };
+        SetShaderValue(shader, locs->tileGrid, &grid, SHADER_UNIFORM_VEC2);
+    }
+    if (locs->tileSize != -1) {
+        float tileSize = (float)LIGHTING_TILE_SIZE;
+        SetShaderValue(shader, locs->tileSize, &tileSize, SHADER_UNIFORM_FLOAT);
+    }
+}
+
+void Lighting_BindTextures(const LightHandler* handler) {
+    if (!handler) return;
+
+    if (handler->lightTexture.id != 0) {
+        rlActiveTextureSlot(LIGHTING_LIGHT_TEXTURE_UNIT);
+        rlEnableTexture(handler->lightTexture.id);
+    }
+    if (handler->tileTexture.id != 0) {
+        rlActiveTextureSlot(LIGHTING_TILE_TEXTURE_UNIT);
+        rlEnableTexture(handler->tileTexture.id);
+    }
+
+    // rlgl uploads bind on whatever unit is active, keep them off ours
+    rlActiveTextureSlot(0);
+}
+
+int Lighting_GetTileLights(const LightHandler* handler, int tileX, int tileY, int* outIndices, int maxIndices) {
+    if (!handler || !handler->tileData || !outIndices) return 0;
+    if (tileX < 0 || tileY < 0 || tileX >= handler->tilesX || tileY >= handler->tilesY) return 0;
+
+    // Texel rows as the shader computes them: tileV + slice * sliceV, then floor
+    int textureHeight = handler->tilesY * LIGHTING_TILE_ROWS;
+    float tileU = (tileX + 0.5f) / handler->tilesX;
+    float tileV = (tileY + 0.5f) / textureHeight;
+    float sliceV = 1.0f / LIGHTING_TILE_ROWS;
+    int column = (int)(tileU * handler->tilesX);
+
+    int count = (int)handler->tileData[(int)(tileV * textureHeight) * handler->tilesX + column];
+    if (count > maxIndices) count = maxIndices;
+    for (int i = 0; i < count; i++) {
+        int row = (int)((tileV + (i + 1) * sliceV) * textureHeight);
+        outIndices[i] = (int)handler->tileData[row * handler->tilesX + column];
+    }
+    return count;
+}
+
+void Lighting_Unload(LightHandler* handler) {
+    if (!handler) return;
+
+    if (handler->lightTexture.id != 0) UnloadTexture(handler->lightTexture);
+    if (handler->tileTexture.id != 0) UnloadTexture(handler->tileTexture);
+    free(handler->tileData);
+    handler->lightTexture = (Texture2D){ 0 };
+    handler->tileTexture = (Texture2D){ 0 };
+    handler->tileData = NULL;
+    handler->tilesX = 0;
+    handler->tilesY = 0;
+}
@@ -0,0 +1,75 @@
+// Forward+ lighting for the 3D handler in Presto Framework Mini
+#pragma once
+
+#include "raylib.h"
+#include "visual-handler_3d.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Lights live in a float texture, LIGHTING_TEXELS_PER_LIGHT texels per row:
+
+        texel 0  position.xyz, range
+        texel 1  direction.xyz, type (0 directional, 1 point, 2 spot)
+        texel 2  color.rgb, intensity
+        texel 3  cos(inner cone), cos(outer cone), enabled, unused
+
+    Only rows of lights changed since the last upload are re-sent. Each frame
+    Lighting_BinLights projects the lights into LIGHTING_TILE_SIZE pixel tiles
+    and uploads the per-tile index lists, so a fragment only evaluates the
+    lights that can reach its tile.
+*/
+#define LIGHTING_MAX_LIGHTS 256
+#define LIGHTING_TEXELS_PER_LIGHT 4
+#define LIGHTING_TILE_SIZE 16
+#define LIGHTING_MAX_LIGHTS_PER_TILE 32
+#define LIGHTING_MAX_SHADERS 16
+
+// DrawMesh only binds material maps, on units 0..MAX_MATERIAL_MAPS-1 (12 in
+// raylib's config.h), and SetShaderValueTexture only reaches the 2D batch, so
+// the light textures are bound by hand on the units above
+#define LIGHTING_LIGHT_TEXTURE_UNIT 12
+#define LIGHTING_TILE_TEXTURE_UNIT 13
+
+// Uniform locations, resolved once per shader. GL recycles program ids, so an
+// entry also matches on the shader's locs array and is dropped by
+// Lighting_ForgetShader.
+typedef struct {
+    unsigned int shaderId;
+    const int* shaderLocs;
+    int ambientColor;
+    int lightData;
+    int tileData;
+    int tileGrid;
+    int tileSize;
+} LightShaderLocations;
+
+const LightShaderLocations* Lighting_GetShaderLocations(Shader shader);
+
+// Call before UnloadShader on any shader that was passed to Lighting_Apply
+void Lighting_ForgetShader(Shader shader);
+
+// Forward+ shader reading the light and tile textures (see above)
+Shader Lighting_LoadForwardPlusShader(void);
+
+// Uploads lights flagged dirty since the last call
+void Lighting_UploadLights(LightHandler* handler);
+
+// Rebuilds the per-tile light lists for a viewport of width x height pixels
+void Lighting_BinLights(LightHandler* handler, Camera3D camera, int width, int height);
+
+// Binds the light data and ambient term to a shader. Needs the tile lists
+// from Lighting_BinLights (Handler3D_Render bins every frame) for dynamic lights
+void Lighting_Apply(LightHandler* handler, Shader shader);
+
+// Binds the light and tile textures to their units; Lighting_Apply and
+// Handler3D_Render do this, call it again if other code used those units
+void Lighting_BindTextures(const LightHandler* handler);
+
+// Light indices binned into tile (tileX, tileY), read back with the same
+// addressing as the shader. Returns how many were written.
+int Lighting_GetTileLights(const LightHandler* handler, int tileX, int tileY, int* outIndices, int maxIndices);
+
+void Lighting_Unload(LightHandler* handler);
@@ -0,0 +1,312 @@
+// Indexed-color palettes implementation for Presto Framework Mini
+#include "visual-palette.h"
+#include "visual-shaders.h"
+#include "visual-rlgl.h"
+#include <string.h>
+
+#define PALETTE_STRINGIFY_(x) #x
+#define PALETTE_STRINGIFY(x) PALETTE_STRINGIFY_(x)
+
+typedef struct {
+    int palette;
+    int first;
+    int count;
+    float interval;
+    float timer;
+    bool active;
+} PaletteCycle;
+
+static const char* paletteFS =
+    "#define PALETTE_SIZE " PALETTE_STRINGIFY(PALETTE_SIZE) ".0\n"
+    "#define PALETTE_COUNT " PALETTE_STRINGIFY(PALETTE_COUNT) ".0\n"
+    "VARYING vec2 fragTexCoord;\n"
+    "VARYING vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform sampler2D paletteTexture;\n"
+    "uniform float paletteRow;\n"
+    "uniform float waterRow;\n"
+    "uniform float waterLine;\n"
+    "uniform float viewHeight;\n"
+    "void main() {\n"
+    "    float index = floor(TEXTURE(texture0, fragTexCoord).r * 255.0 + 0.5);\n"
+    "    if (index < 0.5) discard;\n"
+    "    float screenRow = viewHeight - gl_FragCoord.y;\n"
+    "    float row = (waterLine >= 0.0 && screenRow >= waterLine) ? waterRow : paletteRow;\n"
+    "    vec4 color = TEXTURE(paletteTexture, vec2((index + 0.5) / PALETTE_SIZE, (row + 0.5) / PALETTE_COUNT));\n"
+    "    FRAG_COLOR = color * colDiffuse * fragColor;\n"
+    "}\n";
+
+static Color paletteColors[PALETTE_COUNT][PALETTE_SIZE];
+static int paletteUsed[PALETTE_COUNT];   // Entries filled by LoadIndexedTexture, index 0 reserved
+static uint32_t paletteDirty = 0;        // One bit per palette row
+static Texture2D paletteTexture = { 0 };
+static PaletteCycle paletteCycles[PALETTE_MAX_CYCLES];
+
+static Shader paletteShader = { 0 };
+static bool paletteShaderReady = false;
+static int paletteTextureLoc = -1;
+static int paletteRowLoc = -1;
+static int waterRowLoc = -1;
+static int waterLineLoc = -1;
+static int viewHeightLoc = -1;
+
+static int waterLine = -1;
+static int waterPalette = 0;
+static bool palettesReady = false;
+
+void InitPalettes(void) {
+    if (palettesReady) return;
+
+    memset(paletteColors, 0, sizeof(paletteColors));
+    memset(paletteCycles, 0, sizeof(paletteCycles));
+    for (int i = 0; i < PALETTE_COUNT; i++) paletteUsed[i] = 1;
+
+    Image image = {
+        .data = paletteColors,
+        .width = PALETTE_SIZE,
+        .height = PALETTE_COUNT,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+    paletteTexture = LoadTextureFromImage(image);
+    SetTextureFilter(paletteTexture, TEXTURE_FILTER_POINT);
+
+    paletteShader = LoadPortableShader(NULL, paletteFS);
+    paletteShaderReady = IsPortableShaderReady(paletteShader, "paletteTexture");
+    if (paletteShaderReady) {
+        paletteTextureLoc = GetShaderLocation(paletteShader, "paletteTexture");
+        paletteRowLoc = GetShaderLocation(paletteShader, "paletteRow");
+        waterRowLoc = GetShaderLocation(paletteShader, "waterRow");
+        waterLineLoc = GetShaderLocation(paletteShader, "waterLine");
+        viewHeightLoc = GetShaderLocation(paletteShader, "viewHeight");
+    } else {
+        printf("Warning: Palette shader failed to compile, indexed textures will draw as grayscale\n");
+    }
+
+    paletteDirty = 0;
+    waterLine = -1;
+    waterPalette = 0;
+    palettesReady = true;
+}
+
+void UnloadPalettes(void) {
+    if (!palettesReady) return;
+
+    UnloadTexture(paletteTexture);
+    UnloadShader(paletteShader);
+    paletteTexture = (Texture2D){ 0 };
+    paletteShader = (Shader){ 0 };
+    paletteShaderReady = false;
+    palettesReady = false;
+}
+
+static bool IsValidPalette(int palette) {
+    return palette >= 0 && palette < PALETTE_COUNT;
+}
+
+static void UploadDirtyPalettes(void) {
+    if (!palettesReady || paletteDirty == 0) return;
+
+    for (int row = 0; row < PALETTE_COUNT; row++) {
+        if (!(paletteDirty & (1u << row))) continue;
+        UpdateTextureRec(paletteTexture, (Rectangle){ 0, (float)row, PALETTE_SIZE, 1 }, paletteColors[row]);
+    }
+    paletteDirty = 0;
+}
+
+void UpdatePalettes(float deltaTime) {
+    if (!palettesReady) return;
+
+    for (int i = 0; i < PALETTE_MAX_CYCLES; i++) {
+        PaletteCycle* cycle = &paletteCycles[i];
+        if (!cycle->active) continue;
+
+        cycle->timer += deltaTime;
+        while (cycle->timer >= cycle->interval) {
+            cycle->timer -= cycle->interval;
+
+            // Rotate the range by one entry
+            Color* entries = &paletteColors[cycle->palette][cycle->first];
+            Color last = entries[cycle->count - 1];
+            memmove(&entries[1], &entries[0], sizeof(Color) * (cycle->count - 1));
+            entries[0] = last;
+            paletteDirty |= 1u << cycle->palette;
+        }
+    }
+
+    UploadDirtyPalettes();
+}
+
+static int ColorDistance(Color a, Color b) {
+    int dr = a.r - b.r, dg = a.g - b.g, db = a.b - b.b;
+    return dr * dr + dg * dg + db * db;
+}
+
+static uint8_t FindPaletteIndex(int palette, Color color) {
+    if (color.a == 0) return 0;
+
+    Color* entries = paletteColors[palette];
+    for (int i = 1; i < paletteUsed[palette]; i++) {
+        if (entries[i].r == color.r && entries[i].g == color.g &&
+            entries[i].b == color.b && entries[i].a == color.a) return (uint8_t)i;
+    }
+
+    if (paletteUsed[palette] < PALETTE_SIZE) {
+        int index = paletteUsed[palette]++;
+        entries[index] = color;
+        paletteDirty |= 1u << palette;
+        return (uint8_t)index;
+    }
+
+    int best = 1, bestDistance = ColorDistance(entries[1], color);
+    for (int i = 2; i < PALETTE_SIZE; i++) {
+        int distance = ColorDistance(entries[i], color);
+        if (distance < bestDistance) {
+            best = i;
+            bestDistance = distance;
+        }
+    }
+    return (uint8_t)best;
+}
+
+Texture2D LoadIndexedTexture(const char* path, int palette) {
+    InitPalettes();
+    if (!IsValidPalette(palette)) return (Texture2D){ 0 };
+
+    Image image = LoadImage(path);
+    if (!image.data) {
+        printf("Failed to load indexed texture: %s\n", path);
+        return (Texture2D){ 0 };
+    }
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    int pixelCount = image.width * image.height;
+    uint8_t* indices = (uint8_t*)malloc(pixelCount);
+    if (!indices) {
+        UnloadImage(image);
+        return (Texture2D){ 0 };
+    }
+
+    // Runs of the same color are common in pixel art, so remember the last match
+    const Color* pixels = (const Color*)image.data;
+    Color lastColor = { 0, 0, 0, 0 };
+    uint8_t lastIndex = 0;
+    for (int i = 0; i < pixelCount; i++) {
+        Color c = pixels[i];
+        if (i == 0 || memcmp(&c, &lastColor, sizeof(Color)) != 0) {
+            lastColor = c;
+            lastIndex = FindPaletteIndex(palette, c);
+        }
+        indices[i] = lastIndex;
+    }
+
+    Image indexed = {
+        .data = indices,
+        .width = image.width,
+        .height = image.height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    };
+    Texture2D texture = LoadTextureFromImage(indexed);
+    SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+
+    free(indices);
+    UnloadImage(image);
+    UploadDirtyPalettes();
+    return texture;
+}
+
+void SetPaletteEntry(int palette, int index, Color color) {
+    InitPalettes();
+    if (!IsValidPalette(palette) || index < 0 || index >= PALETTE_SIZE) return;
+
+    paletteColors[palette][index] = color;
+    if (index >= paletteUsed[palette]) paletteUsed[palette] = index + 1;
+    paletteDirty |= 1u << palette;
+}
+
+Color GetPaletteEntry(int palette, int index) {
+    if (!palettesReady || !IsValidPalette(palette) || index < 0 || index >= PALETTE_SIZE) return BLANK;
+    return paletteColors[palette][index];
+}
+
+void CopyPalette(int destination, int source) {
+    InitPalettes();
+    if (!IsValidPalette(destination) || !IsValidPalette(source) || destination == source) return;
+
+    memcpy(paletteColors[destination], paletteColors[source], sizeof(paletteColors[0]));
+    paletteUsed[destination] = paletteUsed[source];
+    paletteDirty |= 1u << destination;
+}
+
+void BlendPalette(int destination, int source, Color tint, float amount) {
+    InitPalettes();
+    if (!IsValidPalette(destination) || !IsValidPalette(source)) return;
+
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        Color c = paletteColors[source][i];
+        paletteColors[destination][i] = (Color){
+            (unsigned char)(c.r + (tint.r - c.r) * amount),
+            (unsigned char)(c.g + (tint.g - c.g) * amount),
+            (unsigned char)(c.b + (tint.b - c.b) * amount),
+            c.a
+        };
+    }
+    paletteUsed[destination] = paletteUsed[source];
+    paletteDirty |= 1u << destination;
+}
+
+int AddPaletteCycle(int palette, int first, int count, float interval) {
+    InitPalettes();
+    if (!IsValidPalette(palette) || count < 2 || interval <= 0.0f) return -1;
+    if (first < 0 || first + count > PALETTE_SIZE) return -1;
+
+    for (int i = 0; i < PALETTE_MAX_CYCLES; i++) {
+        if (paletteCycles[i].active) continue;
+        paletteCycles[i] = (PaletteCycle){ palette, first, count, interval, 0.0f, true };
+        return i;
+    }
+
+    printf("Palette cycle limit reached (%d)\n", PALETTE_MAX_CYCLES);
+    return -1;
+}
+
+void RemovePaletteCycle(int cycle) {
+    if (cycle < 0 || cycle >= PALETTE_MAX_CYCLES) return;
+    paletteCycles[cycle].active = false;
+}
+
+void SetPaletteWaterLine(int screenRow, int palette) {
+    waterLine = screenRow;
+    waterPalette = IsValidPalette(palette) ? palette : 0;
+}
+
+bool IsPaletteShaderReady(void) {
+    InitPalettes();
+    return paletteShaderReady;
+}
+
+void BeginPaletteMode(int palette) {
+    InitPalettes();
+    if (!paletteShaderReady || !IsValidPalette(palette)) return;
+
+    UploadDirtyPalettes();
+
+    float row = (float)palette;
+    float water = (float)waterPalette;
+    float line = (float)waterLine;
+    float viewHeight = (float)rlGetFramebufferHeight();
+
+    BeginShaderMode(paletteShader);
+    SetShaderValue(paletteShader, paletteRowLoc, &row, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(paletteShader, waterRowLoc, &water, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(paletteShader, waterLineLoc, &line, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(paletteShader, viewHeightLoc, &viewHeight, SHADER_UNIFORM_FLOAT);
+    SetShaderValueTexture(paletteShader, paletteTextureLoc, paletteTexture);
+}
+
+void EndPaletteMode(void) {
+    if (!paletteShaderReady) return;
+    EndShaderMode();
+}
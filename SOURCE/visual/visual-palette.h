@@ -0,0 +1,52 @@
+// Indexed-color palettes for Presto Framework Mini
+#pragma once
+
+#include "raylib.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Indexed textures store one 8-bit palette index per pixel (grayscale
+    format, a quarter of the RGBA size). Colors come from a shared
+    PALETTE_SIZE x PALETTE_COUNT texture looked up in a fragment shader,
+    so flashing, tinting and cycling only rewrite a 1KB palette row.
+
+    Index 0 is transparent. Draw indexed textures between BeginPaletteMode
+    and EndPaletteMode; keep as many draws as possible inside one pair since
+    each pair is a batch flush.
+*/
+#define PALETTE_SIZE 256
+#define PALETTE_COUNT 16
+#define PALETTE_MAX_CYCLES 16
+
+void InitPalettes(void);
+void UnloadPalettes(void);
+
+// Runs the palette cycles and uploads palettes changed since the last call
+void UpdatePalettes(float deltaTime);
+
+// Loads an image as an indexed texture. Colors missing from `palette` are
+// appended to it while it has free entries, otherwise the nearest one is used.
+Texture2D LoadIndexedTexture(const char* path, int palette);
+
+void SetPaletteEntry(int palette, int index, Color color);
+Color GetPaletteEntry(int palette, int index);
+void CopyPalette(int destination, int source);
+// Blends the colour of every entry of `source` towards `tint` into `destination`,
+// keeping each entry's alpha (e.g. underwater)
+void BlendPalette(int destination, int source, Color tint, float amount);
+
+// Rotates entries [first, first + count) by one every `interval` seconds. Returns the cycle id.
+int AddPaletteCycle(int palette, int first, int count, float interval);
+void RemovePaletteCycle(int cycle);
+
+// Screen rows at or below `screenRow` use `palette` instead of the active one. -1 disables.
+void SetPaletteWaterLine(int screenRow, int palette);
+
+// False when the palette shader failed to compile; indexed textures then draw as grayscale
+bool IsPaletteShaderReady(void);
+
+void BeginPaletteMode(int palette);
+void EndPaletteMode(void);
@@ -0,0 +1,16 @@
+// rlgl prototypes for Presto Framework Mini
+#pragma once
+
+/*
+    raylib exports its rlgl layer but rlgl.h isn't part of INCLUDE, so the
+    few entry points the visual modules use are declared here, matching
+    raylib 5.x. Add new ones here rather than in a .c file.
+*/
+
+// Size of the bound target: the render texture inside BeginTextureMode, the window otherwise
+int rlGetFramebufferWidth(void);
+int rlGetFramebufferHeight(void);
+
+// Texture unit selection; units DrawMesh doesn't bind keep their texture across draws
+void rlActiveTextureSlot(int slot);
+void rlEnableTexture(unsigned int id);
@@ -1,5 +1,10 @@
 // Visual Root Header
 #pragma once
 #include "visual-sprite_fonts.h"
+#include "visual-shaders.h"
+#include "visual-draw_queue.h"
+#include "visual-backgrounds.h"
+#include "visual-palette.h"
 #include "visual-handler_2d.h"
-#include "visual-handler_3d.h"
\ No newline at end of file
+#include "visual-handler_3d.h"
+#include "visual-lighting.h"
\ No newline at end of file
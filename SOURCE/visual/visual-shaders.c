@@ -0,0 +1,99 @@
+// Shader helpers implementation for Presto Framework Mini
+#include "visual-shaders.h"
+#include <string.h>
+
+#if PRESTO_GLSL_VERSION == 100
+static const char* vsPrelude =
+    "#version 100\n"
+    "#define ATTRIBUTE attribute\n"
+    "#define VARYING varying\n"
+    "#define TEXTURE texture2D\n";
+static const char* fsPrelude =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "#define VARYING varying\n"
+    "#define TEXTURE texture2D\n"
+    "#define FRAG_COLOR gl_FragColor\n";
+#else
+static const char* vsPrelude =
+    "#version 330\n"
+    "#define ATTRIBUTE in\n"
+    "#define VARYING out\n"
+    "#define TEXTURE texture\n";
+static const char* fsPrelude =
+    "#version 330\n"
+    "#define VARYING in\n"
+    "#define TEXTURE texture\n"
+    "out vec4 prestoFragColor;\n"
+    "#define FRAG_COLOR prestoFragColor\n";
+#endif
+
+static const char* instancingVS =
+    "ATTRIBUTE vec3 vertexPosition;\n"
+    "ATTRIBUTE vec2 vertexTexCoord;\n"
+    "ATTRIBUTE mat4 instanceTransform;\n"
+    "uniform mat4 mvp;\n"
+    "VARYING vec2 fragTexCoord;\n"
+    "VARYING vec4 fragColor;\n"
+    "void main() {\n"
+    "    fragColor = vec4(instanceTransform[0][3], instanceTransform[1][3],\n"
+    "                     instanceTransform[2][3], instanceTransform[3][3]);\n"
+    "    mat4 model = instanceTransform;\n"
+    "    model[0][3] = 0.0; model[1][3] = 0.0; model[2][3] = 0.0; model[3][3] = 1.0;\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    gl_Position = mvp * model * vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char* instancingFS =
+    "VARYING vec2 fragTexCoord;\n"
+    "VARYING vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "void main() {\n"
+    "    FRAG_COLOR = TEXTURE(texture0, fragTexCoord) * colDiffuse * fragColor;\n"
+    "}\n";
+
+static char* JoinShaderSource(const char* prelude, const char* body) {
+    size_t preludeLength = strlen(prelude);
+    size_t bodyLength = strlen(body);
+    char* source = (char*)malloc(preludeLength + bodyLength + 1);
+    if (!source) return NULL;
+    memcpy(source, prelude, preludeLength);
+    memcpy(source + preludeLength, body, bodyLength + 1);
+    return source;
+}
+
+Shader LoadPortableShader(const char* vsBody, const char* fsBody) {
+    char* vsCode = vsBody ? JoinShaderSource(vsPrelude, vsBody) : NULL;
+    char* fsCode = fsBody ? JoinShaderSource(fsPrelude, fsBody) : NULL;
+
+    Shader shader = LoadShaderFromMemory(vsCode, fsCode);
+
+    free(vsCode);
+    free(fsCode);
+    return shader;
+}
+
+bool IsPortableShaderReady(Shader shader, const char* uniformName) {
+    if (!IsShaderValid(shader)) return false;
+    return GetShaderLocation(shader, uniformName) != -1;
+}
+
+Shader LoadInstancingShader(void) {
+    Shader shader = LoadPortableShader(instancingVS, instancingFS);
+
+    // DrawMeshInstanced feeds the per-instance matrices to SHADER_LOC_MATRIX_MODEL
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+    if (shader.locs[SHADER_LOC_MATRIX_MODEL] == -1) {
+        printf("Warning: Instancing shader failed to compile, instanced draws are disabled\n");
+    }
+    return shader;
+}
+
+Matrix PackInstanceTint(Matrix transform, Color tint) {
+    transform.m3 = tint.r / 255.0f;
+    transform.m7 = tint.g / 255.0f;
+    transform.m11 = tint.b / 255.0f;
+    transform.m15 = tint.a / 255.0f;
+    return transform;
+}
@@ -0,0 +1,42 @@
+// Shader helpers for Presto Framework Mini
+#pragma once
+
+#include "raylib.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+// GLSL dialect used for embedded shaders: 330 on desktop GL, 100 on GLES2/WebGL
+#ifndef PRESTO_GLSL_VERSION
+    #if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_DRM) || defined(GRAPHICS_API_OPENGL_ES2)
+        #define PRESTO_GLSL_VERSION 100
+    #else
+        #define PRESTO_GLSL_VERSION 330
+    #endif
+#endif
+
+/*
+    Embedded shader bodies are written once against a few macros so the same
+    source compiles as GLSL 330 and GLSL 100:
+
+        ATTRIBUTE   vertex input              (in / attribute)
+        VARYING     vertex output / fragment input (out, in / varying)
+        TEXTURE     2D texture sampling       (texture / texture2D)
+        FRAG_COLOR  fragment output           (custom out / gl_FragColor)
+
+    raylib's default uniform and attribute names (vertexPosition, vertexTexCoord,
+    mvp, colDiffuse, texture0, fragTexCoord, fragColor) are resolved on load.
+*/
+
+// Loads a shader from macro-based GLSL bodies. Pass NULL to use raylib's default for a stage.
+Shader LoadPortableShader(const char* vsBody, const char* fsBody);
+
+// True when the shader compiled and exposes `uniformName`. raylib silently falls
+// back to its default shader on compile errors, which this detects.
+bool IsPortableShaderReady(Shader shader, const char* uniformName);
+
+// Instancing shader for DrawMeshInstanced. The per-instance tint travels in the
+// unused bottom row of each transform (m3, m7, m11, m15 = r, g, b, a); see
+// PackInstanceTint.
+Shader LoadInstancingShader(void);
+Matrix PackInstanceTint(Matrix transform, Color tint);
@@ -12,6 +12,295 @@ DiscoveryFont* discoveryFont = NULL;
 PrestoNumbersFontA* prestoNumbersAFont = NULL;
 PrestoNumbersFontB* prestoNumbersBFont = NULL;
 
+#define GLYPH_ATLAS_MAX_WIDTH 256
+#define GLYPH_ATLAS_MAX_GLYPHS 32
+#define GLYPH_ATLAS_PADDING 1
+
+// Loads the numbered glyph images "<basePath><i>.png" and shelf-packs them into a
+// single atlas texture. Each glyph gets a 1px transparent gutter so neighbours
+// never bleed into each other when scaled. Glyphs that fail to load keep an
+// empty source rectangle. Returns the number of glyphs packed.
+static int BuildGlyphAtlas(const char* basePath, int glyphCount, Texture2D* atlas, Rectangle* sources) {
+    Image images[GLYPH_ATLAS_MAX_GLYPHS] = { 0 };
+    if (glyphCount > GLYPH_ATLAS_MAX_GLYPHS) glyphCount = GLYPH_ATLAS_MAX_GLYPHS;
+
+    // Lay glyphs out on shelves, wrapping when a row would exceed the atlas width
+    int loaded = 0;
+    int atlasWidth = 0;
+    int shelfX = 0, shelfY = 0, shelfHeight = 0;
+    for (int i = 0; i < glyphCount; i++) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s%d.png", basePath, i);
+        sources[i] = (Rectangle){ 0 };
+        if (!FileExists(path)) continue;
+
+        images[i] = LoadImage(path);
+        if (images[i].data == NULL) continue;
+
+        int w = images[i].width + GLYPH_ATLAS_PADDING;
+        int h = images[i].height + GLYPH_ATLAS_PADDING;
+        if (shelfX > 0 && shelfX + w > GLYPH_ATLAS_MAX_WIDTH) {
+            shelfY += shelfHeight;
+            shelfX = 0;
+            shelfHeight = 0;
+        }
+        sources[i] = (Rectangle){ (float)shelfX, (float)shelfY, (float)images[i].width, (float)images[i].height };
+        shelfX += w;
+        if (h > shelfHeight) shelfHeight = h;
+        if (shelfX > atlasWidth) atlasWidth = shelfX;
+        loaded++;
+    }
+
+    *atlas = (Texture2D){ 0 };
+    if (loaded > 0) {
+        Image atlasImage = GenImageColor(atlasWidth, shelfY + shelfHeight, BLANK);
+        for (int i = 0; i < glyphCount; i++) {
+            if (images[i].data == NULL) continue;
+            Rectangle src = { 0, 0, (float)images[i].width, (float)images[i].height };
+            ImageDraw(&atlasImage, images[i], src, sources[i], WHITE);
+        }
+        *atlas = LoadTextureFromImage(atlasImage);
+        UnloadImage(atlasImage);
+    }
+
+    for (int i = 0; i < glyphCount; i++) {
+        if (images[i].data != NULL) UnloadImage(images[i]);
+    }
+    return (atlas->id > 0) ? loaded : 0;
+}
+
+// ===== Glyph lookup =====
+
+// Lookup table entries that are not glyph indices
+#define GLYPH_SKIP  0xFF // Unsupported character: no quad, no advance
+#define GLYPH_SPACE 0xFE // Blank advance of 8px
+
+static unsigned char discoveryLUT[256];
+static unsigned char smallSonicLUT[256];
+static unsigned char prestoNumbersALUT[256];
+static unsigned char prestoNumbersBLUT[256];
+
+// Precomputed 8x8 cells of the small font sheet (zero width when out of bounds)
+static Rectangle smallSonicSources[43];
+
+typedef enum {
+    SPRITE_FONT_DISCOVERY,
+    SPRITE_FONT_SMALL_SONIC,
+    SPRITE_FONT_PRESTO_A,
+    SPRITE_FONT_PRESTO_B
+} SpriteFontId;
+
+static void ResetGlyphLUT(unsigned char* lut) {
+    memset(lut, GLYPH_SKIP, 256);
+    lut[(unsigned char)' '] = GLYPH_SPACE;
+}
+
+// Maps every character of `chars` to consecutive entries of `indices`
+static void MapGlyphLUT(unsigned char* lut, const char* chars, const unsigned char* indices) {
+    for (int i = 0; chars[i] != '\0'; i++) {
+        lut[(unsigned char)chars[i]] = indices[i];
+    }
+}
+
+static void BuildGlyphLUTs(void) {
+    // Discovery and small Sonic fonts fold lowercase onto uppercase
+    ResetGlyphLUT(discoveryLUT);
+    for (int c = 'A'; c <= 'Z'; c++) {
+        discoveryLUT[c] = (unsigned char)(c - 'A');
+        discoveryLUT[c + 32] = (unsigned char)(c - 'A');
+    }
+
+    ResetGlyphLUT(smallSonicLUT);
+    const char* smallGlyphs = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789*.:-=!?";
+    for (int i = 0; smallGlyphs[i] != '\0'; i++) {
+        unsigned char c = (unsigned char)smallGlyphs[i];
+        smallSonicLUT[c] = (unsigned char)i;
+        if (c >= 'A' && c <= 'Z') smallSonicLUT[c + 32] = (unsigned char)i;
+    }
+
+    // Font A: 0=- 1=/ 2=: 3=' 4=" 5=9 6=8 7=7 8=6 9=5 10=4 11=3 12=2 13=1 (no 0)
+    ResetGlyphLUT(prestoNumbersALUT);
+    MapGlyphLUT(prestoNumbersALUT, "123456789-/:'\"",
+                (const unsigned char[]){ 13, 12, 11, 10, 9, 8, 7, 6, 5, 0, 1, 2, 3, 4 });
+
+    // Font B: 0=' 1=/ 2=. 3=- 4=: 5=9 ... 13=1 14=0
+    ResetGlyphLUT(prestoNumbersBLUT);
+    MapGlyphLUT(prestoNumbersBLUT, "0123456789'/.-:",
+                (const unsigned char[]){ 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 0, 1, 2, 3, 4 });
+}
+
+static const unsigned char* GetFontLUT(SpriteFontId font) {
+    switch (font) {
+        case SPRITE_FONT_DISCOVERY:   return discoveryLUT;
+        case SPRITE_FONT_SMALL_SONIC: return smallSonicLUT;
+        case SPRITE_FONT_PRESTO_A:    return prestoNumbersALUT;
+        case SPRITE_FONT_PRESTO_B:    return prestoNumbersBLUT;
+    }
+    return discoveryLUT;
+}
+
+static Texture2D GetFontTexture(SpriteFontId font) {
+    switch (font) {
+        case SPRITE_FONT_DISCOVERY:   return discoveryFont ? discoveryFont->atlas : (Texture2D){ 0 };
+        case SPRITE_FONT_SMALL_SONIC: return smallSonicFont ? smallSonicFont->texture : (Texture2D){ 0 };
+        case SPRITE_FONT_PRESTO_A:    return prestoNumbersAFont ? prestoNumbersAFont->atlas : (Texture2D){ 0 };
+        case SPRITE_FONT_PRESTO_B:    return prestoNumbersBFont ? prestoNumbersBFont->atlas : (Texture2D){ 0 };
+    }
+    return (Texture2D){ 0 };
+}
+
+// Returns the atlas rectangle of a glyph, or a zero-width rectangle when its image is missing
+static Rectangle GetGlyphSource(SpriteFontId font, int index) {
+    switch (font) {
+        case SPRITE_FONT_DISCOVERY:
+            return discoveryFont ? discoveryFont->glyphs[index].source : (Rectangle){ 0 };
+        case SPRITE_FONT_SMALL_SONIC:
+            return smallSonicSources[index];
+        case SPRITE_FONT_PRESTO_A:
+            return prestoNumbersAFont ? prestoNumbersAFont->glyphs[index].source : (Rectangle){ 0 };
+        case SPRITE_FONT_PRESTO_B:
+            return prestoNumbersBFont ? prestoNumbersBFont->glyphs[index].source : (Rectangle){ 0 };
+    }
+    return (Rectangle){ 0 };
+}
+
+// Pen advance for a mapped glyph whose image failed to load
+static float GetMissingGlyphAdvance(SpriteFontId font) {
+    return (font == SPRITE_FONT_DISCOVERY || font == SPRITE_FONT_SMALL_SONIC) ? 8.0f : 0.0f;
+}
+
+// ===== Text layout cache =====
+
+#define TEXT_LAYOUT_CACHE_SIZE 32 // Power of two, direct-mapped
+#define TEXT_LAYOUT_MAX_CHARS 48  // Longer strings are laid out without caching
+
+typedef struct {
+    Rectangle source;
+    Rectangle dest; // Relative to the text origin
+} GlyphQuad;
+
+typedef struct {
+    bool used;
+    SpriteFontId font;
+    float scale;
+    unsigned int hash;
+    char text[TEXT_LAYOUT_MAX_CHARS + 1];
+    int quadCount;
+    GlyphQuad quads[TEXT_LAYOUT_MAX_CHARS];
+} TextLayout;
+
+static TextLayout textLayoutCache[TEXT_LAYOUT_CACHE_SIZE];
+
+static void ClearTextLayoutCache(void) {
+    memset(textLayoutCache, 0, sizeof(textLayoutCache));
+}
+
+// FNV-1a over the string, mixed with the font and scale so each key gets its own slot
+static unsigned int HashTextLayoutKey(const char* text, SpriteFontId font, float scale, size_t* length) {
+    unsigned int hash = 2166136261u;
+    size_t i = 0;
+    for (; text[i] != '\0'; i++) {
+        hash ^= (unsigned char)text[i];
+        hash *= 16777619u;
+    }
+    unsigned int scaleBits;
+    memcpy(&scaleBits, &scale, sizeof(scaleBits));
+    hash ^= scaleBits + 0x9E3779B9u + (hash << 6) + (hash >> 2);
+    hash ^= (unsigned int)font * 0x85EBCA6Bu;
+    *length = i;
+    return hash;
+}
+
+// Lays out one character at the pen position. Returns true and fills `quad` when
+// the character produces a visible glyph; the pen advances either way.
+static bool LayoutGlyph(SpriteFontId font, const unsigned char* lut, char c, float scale, float* penX, GlyphQuad* quad) {
+    unsigned char glyph = lut[(unsigned char)c];
+    if (glyph == GLYPH_SKIP) return false;
+    if (glyph == GLYPH_SPACE) { *penX += 8 * scale; return false; }
+
+    Rectangle source = GetGlyphSource(font, glyph);
+    if (source.width <= 0) {
+        *penX += GetMissingGlyphAdvance(font) * scale;
+        return false;
+    }
+    quad->source = source;
+    quad->dest = (Rectangle){ *penX, 0.0f, source.width * scale, source.height * scale };
+    *penX += source.width * scale;
+    return true;
+}
+
+static void BuildTextLayout(TextLayout* layout, SpriteFontId font, const char* text, float scale) {
+    const unsigned char* lut = GetFontLUT(font);
+    float penX = 0.0f;
+    layout->quadCount = 0;
+    for (int i = 0; text[i] != '\0'; i++) {
+        if (LayoutGlyph(font, lut, text[i], scale, &penX, &layout->quads[layout->quadCount])) {
+            layout->quadCount++;
+        }
+    }
+}
+
+// Returns the cached layout for (text, font, scale), laying it out on a miss.
+// Returns NULL for strings too long to cache.
+static const TextLayout* GetTextLayout(SpriteFontId font, const char* text, float scale) {
+    size_t length;
+    unsigned int hash = HashTextLayoutKey(text, font, scale, &length);
+    if (length > TEXT_LAYOUT_MAX_CHARS) return NULL;
+
+    TextLayout* entry = &textLayoutCache[hash & (TEXT_LAYOUT_CACHE_SIZE - 1)];
+    if (entry->used && entry->hash == hash && entry->font == font &&
+        entry->scale == scale && strcmp(entry->text, text) == 0) {
+        return entry;
+    }
+
+    entry->used = true;
+    entry->hash = hash;
+    entry->font = font;
+    entry->scale = scale;
+    memcpy(entry->text, text, length + 1);
+    BuildTextLayout(entry, font, text, scale);
+    return entry;
+}
+
+// Pen advance of a whole string, the same spacing DrawSpriteFontText uses
+static float MeasureSpriteFontText(SpriteFontId font, const char* text, float scale) {
+    const unsigned char* lut = GetFontLUT(font);
+    float penX = 0.0f;
+    GlyphQuad quad;
+    for (int i = 0; text[i] != '\0'; i++) {
+        LayoutGlyph(font, lut, text[i], scale, &penX, &quad);
+    }
+    return penX;
+}
+
+// Emits a string from the font's single texture so raylib keeps it in one batch
+static void DrawSpriteFontText(SpriteFontId font, const char* text, Vector2 position, float scale, Color tint) {
+    Texture2D texture = GetFontTexture(font);
+    if (texture.id == 0) return;
+
+    const TextLayout* layout = GetTextLayout(font, text, scale);
+    if (layout) {
+        for (int i = 0; i < layout->quadCount; i++) {
+            Rectangle dest = layout->quads[i].dest;
+            dest.x += position.x;
+            dest.y += position.y;
+            DrawTexturePro(texture, layout->quads[i].source, dest, (Vector2){0, 0}, 0.0f, tint);
+        }
+        return;
+    }
+
+    // Uncached path for long strings
+    const unsigned char* lut = GetFontLUT(font);
+    float penX = 0.0f;
+    GlyphQuad quad;
+    for (int i = 0; text[i] != '\0'; i++) {
+        if (!LayoutGlyph(font, lut, text[i], scale, &penX, &quad)) continue;
+        quad.dest.x += position.x;
+        quad.dest.y += position.y;
+        DrawTexturePro(texture, quad.source, quad.dest, (Vector2){0, 0}, 0.0f, tint);
+    }
+}
+
 void InitSpriteFontManager() {
     printf("Initializing Sprite Font Manager...\n");
     
@@ -20,6 +309,8 @@ void InitSpriteFontManager() {
     prestoNumbersBFont = NULL;
     discoveryFont = NULL;
     smallSonicFont = NULL;
+    BuildGlyphLUTs();
+    ClearTextLayoutCache();
     
     // Try to load fonts
     InitDiscoveryFont();
@@ -37,17 +328,15 @@ void InitDiscoveryFont() {
     memset(discoveryFont, 0, sizeof(DiscoveryFont));
     const char* basePath = "RESOURCES/font/DiscoveryFont/";
     // Files appear to be named 0.png..25.png corresponding to A..Z
-    int loaded = 0;
-    for (int i = 0; i < 26; i++) {
-        char path[128];
-        snprintf(path, sizeof(path), "%s%d.png", basePath, i);
-        Texture2D tex = LoadTexture(path);
-        discoveryFont->glyphs[i].texture = tex;
-        discoveryFont->glyphs[i].width = (tex.id > 0) ? tex.width : 0;
-        discoveryFont->glyphs[i].height = (tex.id > 0) ? tex.height : 0;
-        if (tex.id > 0) loaded++;
+    Rectangle sources[26];
+    int loaded = BuildGlyphAtlas(basePath, 26, &discoveryFont->atlas, sources);
+    for (int i = 0; i < 26 && loaded > 0; i++) {
+        discoveryFont->glyphs[i].source = sources[i];
+        discoveryFont->glyphs[i].width = (int)sources[i].width;
+        discoveryFont->glyphs[i].height = (int)sources[i].height;
     }
-    printf("Discovery font: loaded %d/26 glyph textures\n", loaded);
+    printf("Discovery font: packed %d/26 glyphs into a %dx%d atlas\n", loaded,
+           discoveryFont->atlas.width, discoveryFont->atlas.height);
 }
 
 void InitSmallSonicFont() {
@@ -67,6 +356,16 @@ void InitSmallSonicFont() {
     // Ensure null-terminated copy
     strncpy(smallSonicFont->glyphs, glyphs, sizeof(smallSonicFont->glyphs) - 1);
     smallSonicFont->glyphs[sizeof(smallSonicFont->glyphs) - 1] = '\0';
+
+    // Precompute the sheet cell of every glyph (assuming 8x8 tiles arranged in rows)
+    int tilesPerRow = (tex.width > 0) ? tex.width / 8 : 1;
+    if (tilesPerRow <= 0) tilesPerRow = 1; // Prevent division by zero
+    for (int i = 0; i < 43; i++) {
+        int tileX = (i % tilesPerRow) * 8;
+        int tileY = (i / tilesPerRow) * 8;
+        bool inBounds = tex.id > 0 && tileX + 8 <= tex.width && tileY + 8 <= tex.height;
+        smallSonicSources[i] = inBounds ? (Rectangle){ (float)tileX, (float)tileY, 8.0f, 8.0f } : (Rectangle){ 0 };
+    }
 }
 
 void LoadPrestoNumbersFontA(const char* basePath) {
@@ -82,20 +381,15 @@ void LoadPrestoNumbersFontA(const char* basePath) {
     // Initialize all glyphs to zero
     memset(prestoNumbersAFont, 0, sizeof(PrestoNumbersFontA));
     
-    // Load textures (files are numbered 0-13)
-    int loaded = 0;
-    for (int i = 0; i < 14; i++) {
-        char path[256];
-        snprintf(path, sizeof(path), "RESOURCES/font/presto-numbersA/%d.png", i);
-        Texture2D tex = LoadTexture(path);
-        if (tex.id > 0) {
-            prestoNumbersAFont->glyphs[i].texture = tex;
-            prestoNumbersAFont->glyphs[i].width = tex.width;
-            prestoNumbersAFont->glyphs[i].height = tex.height;
-            loaded++;
-        }
+    // Pack glyphs into one atlas (files are numbered 0-13)
+    Rectangle sources[14];
+    int loaded = BuildGlyphAtlas("RESOURCES/font/presto-numbersA/", 14, &prestoNumbersAFont->atlas, sources);
+    for (int i = 0; i < 14 && loaded > 0; i++) {
+        prestoNumbersAFont->glyphs[i].source = sources[i];
+        prestoNumbersAFont->glyphs[i].width = (int)sources[i].width;
+        prestoNumbersAFont->glyphs[i].height = (int)sources[i].height;
     }
-    printf("PrestoNumbersA font: loaded %d/14 glyph textures\n", loaded);
+    printf("PrestoNumbersA font: packed %d/14 glyphs into one atlas\n", loaded);
 }
 
 void LoadPrestoNumbersFontB(const char* basePath) {
@@ -111,22 +405,19 @@ void LoadPrestoNumbersFontB(const char* basePath) {
     // Initialize all glyphs to zero
     memset(prestoNumbersBFont, 0, sizeof(PrestoNumbersFontB));
     
-    // Load textures (files are numbered 0-14)
-    int loaded = 0;
-    for (int i = 0; i < 15; i++) {
-        char path[256];
-        snprintf(path, sizeof(path), "RESOURCES/font/presto-numbersB/%d.png", i);
-        Texture2D tex = LoadTexture(path);
-        if (tex.id > 0) {
-            prestoNumbersBFont->glyphs[i].texture = tex;
-            prestoNumbersBFont->glyphs[i].width = tex.width;
-            prestoNumbersBFont->glyphs[i].height = tex.height;
-            loaded++;
-        }
+    // Pack glyphs into one atlas (files are numbered 0-14)
+    Rectangle sources[15];
+    int loaded = BuildGlyphAtlas("RESOURCES/font/presto-numbersB/", 15, &prestoNumbersBFont->atlas, sources);
+    for (int i = 0; i < 15 && loaded > 0; i++) {
+        prestoNumbersBFont->glyphs[i].source = sources[i];
+        prestoNumbersBFont->glyphs[i].width = (int)sources[i].width;
+        prestoNumbersBFont->glyphs[i].height = (int)sources[i].height;
     }
-    printf("PrestoNumbersB font: loaded %d/15 glyph textures\n", loaded);
+    printf("PrestoNumbersB font: packed %d/15 glyphs into one atlas\n", loaded);
 }
 
+// ===== Drawing and measuring =====
+
 void DrawDiscoveryText(const char* text, Vector2 position, float scale, Color tint) {
     if (!text) return;
     
@@ -136,32 +427,18 @@ void DrawDiscoveryText(const char* text, Vector2 position, float scale, Color ti
         return;
     }
     
-    Vector2 pos = position;
-    for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        if (c == ' ') { pos.x += 8 * scale; continue; }
-        if (c >= 'a' && c <= 'z') c -= 32; // Uppercase
-        if (c < 'A' || c > 'Z') continue; // Skip unsupported characters
-        DiscoveryGlyph glyph = discoveryFont->glyphs[c - 'A'];
-        if (glyph.texture.id > 0) {
-            DrawTextureEx(glyph.texture, pos, 0.0f, scale, tint);
-            pos.x += (glyph.width > 0 ? glyph.width : 8) * scale;
-        } else {
-            pos.x += 8 * scale;
-        }
-    }
+    DrawSpriteFontText(SPRITE_FONT_DISCOVERY, text, position, scale, tint);
 }
 
 int MeasureDiscoveryTextWidth(const char* text, float scale) {
     if (!text) return 0;
     int width = 0;
     for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        if (c == ' ') { width += (int)(8 * scale); continue; }
-        if (c >= 'a' && c <= 'z') c -= 32;
-        if (c < 'A' || c > 'Z') continue;
-        DiscoveryGlyph glyph = discoveryFont ? discoveryFont->glyphs[c - 'A'] : (DiscoveryGlyph){0};
-        width += (int)(((glyph.width > 0) ? glyph.width : 8) * scale);
+        unsigned char glyph = discoveryLUT[(unsigned char)text[i]];
+        if (glyph == GLYPH_SKIP) continue;
+        if (glyph == GLYPH_SPACE) { width += (int)(8 * scale); continue; }
+        int glyphWidth = discoveryFont ? discoveryFont->glyphs[glyph].width : 0;
+        width += (int)(((glyphWidth > 0) ? glyphWidth : 8) * scale);
     }
     return width;
 }
@@ -172,7 +449,7 @@ int MeasureDiscoveryTextHeight(const char* text, float scale) {
     int h = 0;
     if (discoveryFont) {
         for (int i = 0; i < 26; i++) {
-            if (discoveryFont->glyphs[i].texture.id > 0 && discoveryFont->glyphs[i].height > 0) {
+            if (discoveryFont->glyphs[i].height > 0) {
                 h = discoveryFont->glyphs[i].height;
                 break;
             }
@@ -186,61 +463,19 @@ void DrawSmallSonicText(const char* text, Vector2 position, float scale, Color t
     if (!text) return;
     
     // Fallback to default font if sprite font not available
-    if (!smallSonicFont) {
-        DrawText(text, (int)position.x, (int)position.y, (int)(10 * scale), tint);
-        return;
-    }
-    if (smallSonicFont->texture.id == 0) {
+    if (!smallSonicFont || smallSonicFont->texture.id == 0) {
         DrawText(text, (int)position.x, (int)position.y, (int)(10 * scale), tint);
         return;
     }
     
-    Vector2 pos = position;
-    for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        
-        if (c == ' ') {
-            pos.x += 8 * scale; // Space width
-            continue;
-        }
-        
-        // Normalize lowercase
-        if (c >= 'a' && c <= 'z') c -= 32;
-        char* glyphPos = strchr(smallSonicFont->glyphs, c);
-        if (!glyphPos) continue; // Skip unsupported characters
-        
-        int index = glyphPos - smallSonicFont->glyphs;
-        
-        // Calculate position in spritesheet (assuming 8x8 tiles arranged in rows)
-        if (smallSonicFont->texture.width <= 0) continue; // Safety check
-        int tilesPerRow = smallSonicFont->texture.width / 8;
-        if (tilesPerRow <= 0) tilesPerRow = 1; // Prevent division by zero
-        
-        int tileX = (index % tilesPerRow) * 8;
-        int tileY = (index / tilesPerRow) * 8;
-        
-        // Bounds check
-        if (tileX >= 0 && tileY >= 0 && 
-            tileX + 8 <= smallSonicFont->texture.width && 
-            tileY + 8 <= smallSonicFont->texture.height) {
-            
-            Rectangle sourceRec = { (float)tileX, (float)tileY, 8.0f, 8.0f };
-            Rectangle destRec = { pos.x, pos.y, 8.0f * scale, 8.0f * scale };
-            
-            DrawTexturePro(smallSonicFont->texture, sourceRec, destRec, (Vector2){0, 0}, 0.0f, tint);
-        }
-        pos.x += 8 * scale;
-    }
+    DrawSpriteFontText(SPRITE_FONT_SMALL_SONIC, text, position, scale, tint);
 }
 
 int MeasureSmallSonicTextWidth(const char* text, float scale) {
     if (!text) return 0;
     int width = 0;
     for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        if (c == ' ') { width += (int)(8 * scale); continue; }
-        if (c >= 'a' && c <= 'z') c -= 32;
-        if (!strchr("ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789*.:-=!?", c)) continue;
+        if (smallSonicLUT[(unsigned char)text[i]] == GLYPH_SKIP) continue;
         width += (int)(8 * scale);
     }
     return width;
@@ -248,111 +483,38 @@ int MeasureSmallSonicTextWidth(const char* text, float scale) {
 
 void DrawPrestoNumbersA(const char* text, Vector2 position, float scale, Color tint) {
     if (!text || !prestoNumbersAFont) return;
-    
-    Vector2 pos = position;
-    for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        int glyphIndex = -1;
-        
-        // Map characters to glyph indices (actual font layout)
-        // Font A: 0='  1=? 2=? 3=? 4=? 5=9 6=8 7=7 8=6 9=5 10=4 11=3 12=2 13=1 (no 0?)
-        if (c >= '0' && c <= '9') {
-            if (c == '1') glyphIndex = 13;
-            else if (c == '2') glyphIndex = 12;
-            else if (c == '3') glyphIndex = 11;
-            else if (c == '4') glyphIndex = 10;
-            else if (c == '5') glyphIndex = 9;
-            else if (c == '6') glyphIndex = 8;
-            else if (c == '7') glyphIndex = 7;
-            else if (c == '8') glyphIndex = 6;
-            else if (c == '9') glyphIndex = 5;
-            // '0' might be in indices 1-4 somewhere
-        } else if (c == '-') {
-            glyphIndex = 0; // Apostrophe at index 0
-        } else if (c == '/') {
-            glyphIndex = 1; // Try slash at index 1
-        } else if (c == ':') {
-            glyphIndex = 2; // Try colon at index 2
-        } else if (c == '\'') {
-            glyphIndex = 3; // Try apostrophe at index 3
-        } else if (c == '"') {
-            glyphIndex = 4; // Try quote at index 4
-        }
-        
-        if (glyphIndex >= 0 && glyphIndex < 14) {
-            PrestoNumbersAGlyph glyph = prestoNumbersAFont->glyphs[glyphIndex];
-            if (glyph.texture.id > 0) {
-                DrawTextureEx(glyph.texture, pos, 0.0f, scale, tint);
-                pos.x += glyph.width * scale;
-            }
-        } else if (c == ' ') {
-            pos.x += 8 * scale; // Space width
-        }
-    }
+    DrawSpriteFontText(SPRITE_FONT_PRESTO_A, text, position, scale, tint);
 }
 
 void DrawPrestoNumbersB(const char* text, Vector2 position, float scale, Color tint) {
     if (!text || !prestoNumbersBFont) return;
-    
-    Vector2 pos = position;
-    for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        int glyphIndex = -1;
-        
-        // Map characters to glyph indices (actual font layout for font B)
-        // Similar pattern but with 15 files (0-14)
-        if (c >= '0' && c <= '9') {
-            if (c == '0') glyphIndex = 14;
-            else if (c == '1') glyphIndex = 13;
-            else if (c == '2') glyphIndex = 12;
-            else if (c == '3') glyphIndex = 11;
-            else if (c == '4') glyphIndex = 10;
-            else if (c == '5') glyphIndex = 9;
-            else if (c == '6') glyphIndex = 8;
-            else if (c == '7') glyphIndex = 7;
-            else if (c == '8') glyphIndex = 6;
-            else if (c == '9') glyphIndex = 5;
-        } else if (c == '\'') {
-            glyphIndex = 0; // Apostrophe at index 0
-        } else if (c == '/') {
-            glyphIndex = 1; // Try slash at index 1
-        } else if (c == '.') {
-            glyphIndex = 2; // Try period at index 2
-        } else if (c == '-') {
-            glyphIndex = 3; // Try dash at index 3
-        } else if (c == ':') {
-            glyphIndex = 4; // Try slash at index 4
-        }
-        
-        if (glyphIndex >= 0 && glyphIndex < 15) {
-            PrestoNumbersBGlyph glyph = prestoNumbersBFont->glyphs[glyphIndex];
-            if (glyph.texture.id > 0) {
-                DrawTextureEx(glyph.texture, pos, 0.0f, scale, tint);
-                pos.x += glyph.width * scale;
-            }
-        } else if (c == ' ') {
-            pos.x += 8 * scale; // Space width
-        }
-    }
+    DrawSpriteFontText(SPRITE_FONT_PRESTO_B, text, position, scale, tint);
+}
+
+int MeasurePrestoNumbersBWidth(const char* text, float scale) {
+    if (!text || !prestoNumbersBFont) return 0;
+    return (int)MeasureSpriteFontText(SPRITE_FONT_PRESTO_B, text, scale);
 }
 
 void UnloadPrestoNumbersFontA() {
     if (prestoNumbersAFont) {
-        for (int i = 0; i < 14; i++) {
-            UnloadTexture(prestoNumbersAFont->glyphs[i].texture);
+        if (prestoNumbersAFont->atlas.id > 0) {
+            UnloadTexture(prestoNumbersAFont->atlas);
         }
         free(prestoNumbersAFont);
         prestoNumbersAFont = NULL;
+        ClearTextLayoutCache();
     }
 }
 
 void UnloadPrestoNumbersFontB() {
     if (prestoNumbersBFont) {
-        for (int i = 0; i < 15; i++) {
-            UnloadTexture(prestoNumbersBFont->glyphs[i].texture);
+        if (prestoNumbersBFont->atlas.id > 0) {
+            UnloadTexture(prestoNumbersBFont->atlas);
         }
         free(prestoNumbersBFont);
         prestoNumbersBFont = NULL;
+        ClearTextLayoutCache();
     }
 }
 
@@ -361,10 +523,8 @@ void CleanupSpriteFontManager() {
     
     // Unload Discovery font
     if (discoveryFont) {
-        for (int i = 0; i < 26; i++) {
-            if (discoveryFont->glyphs[i].texture.id > 0) {
-                UnloadTexture(discoveryFont->glyphs[i].texture);
-            }
+        if (discoveryFont->atlas.id > 0) {
+            UnloadTexture(discoveryFont->atlas);
         }
         free(discoveryFont);
         discoveryFont = NULL;
@@ -382,6 +542,7 @@ void CleanupSpriteFontManager() {
     // Unload Presto Numbers fonts
     UnloadPrestoNumbersFontA();
     UnloadPrestoNumbersFontB();
+    ClearTextLayoutCache();
     
     printf("Sprite Font Manager cleanup complete\n");
 }
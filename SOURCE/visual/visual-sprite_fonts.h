@@ -5,33 +5,38 @@
 
 #include "raylib.h"
 
+// Glyph metrics: source rectangle inside the owning font's atlas texture.
+// A glyph whose image failed to load has a width of 0.
 typedef struct {
-    Texture2D texture;
+    Rectangle source;
     int width;
     int height;
 } PrestoNumbersAGlyph;
 
 typedef struct {
-    Texture2D texture;
+    Rectangle source;
     int width;
     int height;
 } PrestoNumbersBGlyph;
 
 typedef struct {
+    Texture2D atlas; // All glyphs packed into one texture so a string draws in one batch
     PrestoNumbersAGlyph glyphs[15];
 } PrestoNumbersFontA;
 
 typedef struct {
+    Texture2D atlas;
     PrestoNumbersBGlyph glyphs[15];
 } PrestoNumbersFontB;
 
 typedef struct {
-    Texture2D texture;
+    Rectangle source;
     int width;
     int height;
 } DiscoveryGlyph;
 
 typedef struct {
+    Texture2D atlas;
     DiscoveryGlyph glyphs[26];
 } DiscoveryFont;
 
@@ -60,6 +65,7 @@ void DrawSmallSonicText(const char* text, Vector2 position, float scale, Color t
 int MeasureSmallSonicTextWidth(const char* text, float scale);
 void DrawPrestoNumbersA(const char* text, Vector2 position, float scale, Color tint);
 void DrawPrestoNumbersB(const char* text, Vector2 position, float scale, Color tint);
+int MeasurePrestoNumbersBWidth(const char* text, float scale);
 void UnloadPrestoNumbersFontA();
 void UnloadPrestoNumbersFontB();
 void CleanupSpriteFontManager();